@@ -0,0 +1,95 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../include/argmin.h"
+
+// Microbenchmark del kernel eligible_argmin: compara la versión escalar con las
+// vectoriales sobre columnas de distintos tamaños.
+// Uso: bench_argmin [repeticiones]
+
+#define NUM_SIZES 5
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Mide el tiempo medio por llamada (ns) de una implementación.
+ */
+static double time_impl(eligible_argmin_fn fn, const int *arrival, const int *remaining, int n,
+                        int current_time, int reps, int *result) {
+    volatile int sink = 0;
+    double start = now_seconds();
+    for (int r = 0; r < reps; r++) {
+        sink += fn(arrival, remaining, n, current_time);
+    }
+    double elapsed = now_seconds() - start;
+    *result = fn(arrival, remaining, n, current_time);
+    (void)sink;
+    return elapsed * 1e9 / reps;
+}
+
+int main(int argc, char **argv) {
+    const int sizes[NUM_SIZES] = {64, 1024, 16384, 262144, 4194304};
+    long long budget = argc > 1 ? atoll(argv[1]) : 200000000LL; // Elementos procesados por medición
+
+    struct {
+        const char *name;
+        eligible_argmin_fn fn;
+        int supported;
+    } impls[] = {
+        {"scalar", eligible_argmin_scalar, 1},
+#if defined(__x86_64__) || defined(__i386__)
+        {"sse4.1", eligible_argmin_sse41, __builtin_cpu_supports("sse4.1")},
+        {"avx2", eligible_argmin_avx2, __builtin_cpu_supports("avx2")},
+#endif
+    };
+    int num_impls = sizeof(impls) / sizeof(impls[0]);
+
+    printf("# eligible_argmin: implementación seleccionada = %s\n", eligible_argmin_name());
+    printf("impl,n,ns_per_call,elements_per_ns,speedup_vs_scalar\n");
+
+    for (int s = 0; s < NUM_SIZES; s++) {
+        int n = sizes[s];
+        int *arrival = malloc(n * sizeof(int));
+        int *remaining = malloc(n * sizeof(int));
+        if (!arrival || !remaining) {
+            perror("Fallo en la asignación de memoria para el benchmark");
+            return 1;
+        }
+
+        // Mitad de los procesos ya llegaron, un 10% terminó; el mínimo queda al final
+        srand(42);
+        for (int i = 0; i < n; i++) {
+            arrival[i] = rand() % 1000;
+            remaining[i] = (rand() % 10 == 0) ? 0 : 10 + rand() % 1000;
+        }
+        arrival[n - 1] = 0;
+        remaining[n - 1] = 1;
+
+        int reps = (int)(budget / n);
+        if (reps < 1) reps = 1;
+
+        double scalar_ns = 0.0;
+        int expected = -1;
+        for (int k = 0; k < num_impls; k++) {
+            if (!impls[k].supported) continue;
+            int result;
+            double ns = time_impl(impls[k].fn, arrival, remaining, n, 500, reps, &result);
+            if (k == 0) {
+                scalar_ns = ns;
+                expected = result;
+            } else if (result != expected) {
+                fprintf(stderr, "Resultado distinto en %s (n=%d): %d != %d\n", impls[k].name, n, result, expected);
+                return 1;
+            }
+            printf("%s,%d,%.1f,%.2f,%.2f\n", impls[k].name, n, ns, n / ns, scalar_ns / ns);
+        }
+
+        free(arrival);
+        free(remaining);
+    }
+    return 0;
+}
@@ -0,0 +1,193 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include "../include/scheduler.h"
+#include "../include/algorithms.h"
+#include "../include/buffers.h"
+
+// Benchmark de los planificadores principales (FIFO, SJF, STCF, RR y MLFQ) sobre
+// workloads sintéticos de 10^2 a max_procesos procesos y varias distribuciones de
+// ráfagas. Cada configuración se mide en un proceso hijo (fork) para que el pico
+// de memoria (RSS) sea solo suyo; se repite y se reportan mediana y MAD.
+// La salida es CSV, con el commit en cada fila para comparar corridas.
+// Uso: bench_schedulers [max_procesos] [repeticiones] [semilla]
+
+#ifndef BENCH_COMMIT
+#define BENCH_COMMIT "desconocido"
+#endif
+
+#define NUM_ALGORITHMS 5
+#define NUM_DISTRIBUTIONS 3
+#define MAX_REPS 64
+#define TARGET_LOAD 0.9         // Utilización media buscada con las llegadas de Poisson
+#define RR_QUANTUM 4
+
+static const char *algorithm_names[NUM_ALGORITHMS] = {"fifo", "sjf", "stcf", "rr", "mlfq"};
+
+// Ráfagas: uniforme en [1, 20], exponencial discreta (geométrica en {1, 2, ...})
+// de media 10, bimodal (90% cortas en [1, 5], 10% largas en [50, 100])
+static const char *distribution_names[NUM_DISTRIBUTIONS] = {"uniform", "exponential", "bimodal"};
+static const double distribution_means[NUM_DISTRIBUTIONS] = {10.5, 10.0, 10.2};
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// --- Workloads Sintéticos ---
+
+/**
+ * @brief Generador xorshift64*: reproducible para una misma semilla.
+ */
+static unsigned long long next_random(unsigned long long *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ULL;
+}
+
+/**
+ * @brief Uniforme en (0, 1].
+ */
+static double next_unit(unsigned long long *state) {
+    return ((next_random(state) >> 11) + 1.0) / 9007199254740992.0;
+}
+
+static int next_burst(int distribution, unsigned long long *state) {
+    switch (distribution) {
+        case 0: return 1 + (int)(next_random(state) % 20);
+        case 1: // Geométrica de media exacta distribution_means[1] (como en workload_gen.c)
+            return 1 + (int)floor(log(next_unit(state)) / log1p(-1.0 / distribution_means[1]));
+        default:
+            if (next_random(state) % 10 != 0) return 1 + (int)(next_random(state) % 5);
+            return 50 + (int)(next_random(state) % 51);
+    }
+}
+
+/**
+ * @brief n procesos con llegadas de Poisson (carga media TARGET_LOAD) y
+ * ráfagas según la distribución.
+ */
+static void generate_workload(process_t *processes, int n, int distribution, unsigned long long seed) {
+    unsigned long long state = seed * 0x9E3779B97F4A7C15ULL + (unsigned long long)distribution + 1;
+    double mean_gap = distribution_means[distribution] / TARGET_LOAD;
+    double arrival = 0.0;
+    memset(processes, 0, n * sizeof(process_t));
+    for (int i = 0; i < n; i++) {
+        processes[i].pid = i + 1;
+        processes[i].arrival_time = (int)arrival;
+        processes[i].burst_time = next_burst(distribution, &state);
+        processes[i].priority = 1 + (int)(next_random(&state) % 5);
+        arrival += -log(next_unit(&state)) * mean_gap;
+    }
+}
+
+// --- Medición ---
+
+static void run_algorithm(int alg, process_t *processes, int n, timeline_t *timeline) {
+    mlfq_config_t mlfq = {.num_queues = 3, .quantums = {2, 4, 8}, .boost_interval = 100};
+    switch (alg) {
+        case 0: schedule_fifo(processes, n, timeline); break;
+        case 1: schedule_sjf(processes, n, timeline); break;
+        case 2: schedule_stcf(processes, n, timeline); break;
+        case 3: schedule_rr(processes, n, RR_QUANTUM, timeline); break;
+        default: schedule_mlfq(processes, n, &mlfq, timeline); break;
+    }
+}
+
+static int compare_double(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static double median(double *values, int count) {
+    qsort(values, count, sizeof(double), compare_double);
+    return count % 2 ? values[count / 2] : (values[count / 2 - 1] + values[count / 2]) / 2.0;
+}
+
+/**
+ * @brief Mide una configuración (en el proceso hijo) e imprime su fila CSV.
+ * Decisiones de planificación = segmentos despachados a un proceso (pid > 0).
+ * @return 0 si tuvo éxito, 1 si falló la asignación de memoria.
+ */
+static int bench_config(int alg, int distribution, int n, int reps, unsigned long long seed) {
+    process_t *original = malloc(n * sizeof(process_t));
+    process_t *processes = malloc(n * sizeof(process_t));
+    if (!original || !processes) {
+        perror("Fallo en la asignación de memoria para el benchmark");
+        return 1;
+    }
+    generate_workload(original, n, distribution, seed);
+
+    timeline_t timeline;
+    timeline_init(&timeline);
+    double times[MAX_REPS], deviations[MAX_REPS];
+    for (int r = 0; r < reps; r++) {
+        reset_processes(processes, n, original);
+        double start = now_seconds();
+        run_algorithm(alg, processes, n, &timeline);
+        times[r] = now_seconds() - start;
+    }
+
+    long long decisions = 0;
+    for (int e = 0; e < timeline.count; e++) decisions += timeline.events[e].pid > 0;
+
+    double med = median(times, reps);
+    for (int r = 0; r < reps; r++) deviations[r] = fabs(times[r] - med);
+    double mad = median(deviations, reps);
+
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    printf("%s,%s,%s,%d,%d,%.6f,%.6f,%.3f,%lld,%.1f,%ld\n", BENCH_COMMIT, algorithm_names[alg],
+           distribution_names[distribution], n, reps, med, mad, 1.0 / med, decisions,
+           med * 1e9 / (decisions > 0 ? decisions : 1), usage.ru_maxrss);
+
+    timeline_free(&timeline);
+    free(processes);
+    free(original);
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    int max_procs = argc > 1 ? atoi(argv[1]) : 10000000;
+    int reps = argc > 2 ? atoi(argv[2]) : 5;
+    unsigned long long seed = argc > 3 ? strtoull(argv[3], NULL, 10) : 42;
+    if (max_procs < 100 || reps < 1 || reps > MAX_REPS) {
+        fprintf(stderr, "Uso: %s [max_procesos >= 100] [repeticiones 1-%d] [semilla]\n", argv[0], MAX_REPS);
+        return 1;
+    }
+
+    printf("# bench_schedulers: commit=%s, max_procesos=%d, repeticiones=%d, semilla=%llu\n",
+           BENCH_COMMIT, max_procs, reps, seed);
+    printf("commit,alg,dist,procs,reps,median_s,mad_s,sims_per_sec,decisions,ns_per_decision,peak_rss_kb\n");
+    fflush(stdout);
+
+    for (long long n = 100; n <= max_procs; n *= 10) {
+        for (int distribution = 0; distribution < NUM_DISTRIBUTIONS; distribution++) {
+            for (int alg = 0; alg < NUM_ALGORITHMS; alg++) {
+                pid_t child = fork();
+                if (child < 0) {
+                    perror("Error al crear el proceso del benchmark");
+                    return 1;
+                }
+                if (child == 0) {
+                    int status = bench_config(alg, distribution, (int)n, reps, seed);
+                    fflush(stdout);
+                    _exit(status);
+                }
+                int status;
+                if (waitpid(child, &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+                    fprintf(stderr, "%s/%s con %lld procesos falló\n", algorithm_names[alg],
+                            distribution_names[distribution], n);
+                }
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,101 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../include/scheduler.h"
+#include "../include/algorithms.h"
+#include "../include/buffers.h"
+
+// Benchmark de reparto proporcional: stride y lotería con muchos procesos
+// ejecutables a la vez. Mide el costo por despacho y qué tan cerca queda el
+// tiempo de CPU recibido del reparto ideal según los tickets.
+// Uso: bench_share [procesos] [burst]
+
+#define NUM_CLASSES 3
+
+static const int class_nice[NUM_CLASSES] = {0, 5, 10};
+static const double class_tickets[NUM_CLASSES] = {1024, 335, 110}; // Pesos nice de Linux
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 100000;
+    int burst = argc > 2 ? atoi(argv[2]) : 40;
+    if (n < NUM_CLASSES || burst < 1) {
+        fprintf(stderr, "Uso: %s [procesos >= %d] [burst >= 1]\n", argv[0], NUM_CLASSES);
+        return 1;
+    }
+
+    process_t *original = calloc(n, sizeof(process_t));
+    process_t *processes = malloc(n * sizeof(process_t));
+    double *service = malloc(n * sizeof(double));
+    if (!original || !processes || !service) {
+        perror("Fallo en la asignación de memoria para el benchmark");
+        return 1;
+    }
+
+    // Todos llegan en T=0; las clases de prioridad se alternan
+    double total_tickets = 0.0;
+    for (int i = 0; i < n; i++) {
+        original[i].pid = i + 1;
+        original[i].burst_time = burst;
+        original[i].priority = class_nice[i % NUM_CLASSES];
+        total_tickets += class_tickets[i % NUM_CLASSES];
+    }
+
+    // Ventana medida: un cuarto de la simulación, antes de que termine ningún proceso
+    // (con reparto ideal, la clase con más tickets usa ~la mitad de su burst).
+    long long window = (long long)n * burst / 4;
+
+    printf("# %d procesos ejecutables, burst=%d, ventana=[0, %lld)\n", n, burst, window);
+    printf("alg,ns_per_dispatch,dispatches,class_nice,ideal_share,actual_share,mean_abs_err_per_proc\n");
+
+    for (int alg = 0; alg < 2; alg++) {
+        const char *name = alg == 0 ? "stride" : "lottery";
+        timeline_t timeline;
+        timeline_init(&timeline);
+        reset_processes(processes, n, original);
+
+        double start = now_seconds();
+        if (alg == 0) {
+            schedule_stride(processes, n, 1, &timeline);
+        } else {
+            schedule_lottery(processes, n, 1, 42, &timeline);
+        }
+        double elapsed = now_seconds() - start;
+        long long dispatches = (long long)n * burst; // quantum = 1: un despacho por unidad
+
+        // Tiempo de CPU de cada proceso dentro de la ventana
+        for (int i = 0; i < n; i++) service[i] = 0.0;
+        for (int e = 0; e < timeline.count && timeline.events[e].pid != 0; e++) {
+            const timeline_event_t *ev = &timeline.events[e];
+            if (ev->pid < 1 || ev->time >= window) continue;
+            long long end = ev->time + ev->duration < window ? ev->time + ev->duration : window;
+            service[ev->pid - 1] += (double)(end - ev->time);
+        }
+
+        for (int c = 0; c < NUM_CLASSES; c++) {
+            double ideal_proc = window * class_tickets[c] / total_tickets;
+            double actual = 0.0, ideal = 0.0, abs_err = 0.0;
+            int members = 0;
+            for (int i = c; i < n; i += NUM_CLASSES) {
+                actual += service[i];
+                ideal += ideal_proc;
+                abs_err += service[i] > ideal_proc ? service[i] - ideal_proc : ideal_proc - service[i];
+                members++;
+            }
+            printf("%s,%.1f,%lld,%d,%.4f,%.4f,%.3f\n", name, elapsed * 1e9 / dispatches, dispatches,
+                   class_nice[c], ideal / window, actual / window, abs_err / members);
+        }
+
+        timeline_free(&timeline);
+    }
+
+    free(service);
+    free(processes);
+    free(original);
+    return 0;
+}
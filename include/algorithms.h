@@ -2,39 +2,113 @@
 #define ALGORITHMS_H
 
 #include "scheduler.h" // Incluye las estructuras process_t, mlfq_config_t, timeline_event_t, etc.
+#include "buffers.h"   // Línea de tiempo dinámica timeline_t
+#include "proc_table.h" // Tabla SoA proc_table_t
 
 // --- Prototipos de las Funciones de Planificación ---
+// Todos los planificadores vacían la línea de tiempo recibida antes de llenarla.
 
 /**
  * @brief Implementa el algoritmo FIFO (First In First Out).
  * No preemptivo. Ordena por arrival_time.
  */
-void schedule_fifo(process_t *processes, int n, timeline_event_t *timeline);
+void schedule_fifo(process_t *processes, int n, timeline_t *timeline);
 
 /**
  * @brief Implementa el algoritmo SJF (Shortest Job First).
  * No preemptivo. Selecciona el trabajo con el menor burst_time entre los procesos arribados.
+ * Los procesos listos se mantienen en un min-heap (ready_queue_t).
  */
-void schedule_sjf(process_t *processes, int n, timeline_event_t *timeline);
+void schedule_sjf(process_t *processes, int n, timeline_t *timeline);
 
 /**
  * @brief Implementa el algoritmo STCF (Shortest Time to Completion First).
  * Preemptivo. Selecciona el proceso con el menor remaining_time entre los procesos arribados.
+ * Motor por eventos discretos: el reloj salta entre llegadas y finalizaciones,
+ * y cada decisión de planificación cuesta O(log n) gracias a un min-heap.
  */
-void schedule_stcf(process_t *processes, int n, timeline_event_t *timeline);
+void schedule_stcf(process_t *processes, int n, timeline_t *timeline);
+
+/**
+ * @brief Versión de referencia de STCF que avanza el reloj una unidad de tiempo a la vez.
+ * Produce la misma línea de tiempo que schedule_stcf; se usa para validarlo.
+ */
+void schedule_stcf_tick(process_t *processes, int n, timeline_t *timeline);
+
+/**
+ * @brief Implementa un planificador justo tipo CFS (Completely Fair Scheduler de Linux).
+ * Preemptivo: ejecuta el proceso con menor vruntime, que avanza en proporción
+ * inversa a su peso (priority se interpreta como el valor nice de Linux).
+ */
+void schedule_cfs(process_t *processes, int n, cfs_config_t *config,
+                  timeline_t *timeline);
+
+/**
+ * @brief Implementa stride scheduling (reparto proporcional determinista).
+ * Cada proceso recibe tickets según su prioridad (el mismo peso que CFS) y se
+ * ejecuta por quantums el de menor "pass", que avanza en proporción inversa a
+ * sus tickets.
+ */
+void schedule_stride(process_t *processes, int n, int quantum,
+                     timeline_t *timeline);
+
+/**
+ * @brief Implementa lottery scheduling (reparto proporcional aleatorio).
+ * En cada quantum se sortea el proceso a ejecutar con probabilidad proporcional
+ * a sus tickets. La misma semilla produce siempre la misma planificación.
+ */
+void schedule_lottery(process_t *processes, int n, int quantum, unsigned int seed,
+                      timeline_t *timeline);
+
+/**
+ * @brief Implementa planificación por prioridades estáticas (menor valor = mayor
+ * prioridad), preemptiva o no según config->preemptive.
+ * Con aging, la prioridad efectiva de un proceso en espera mejora un nivel por
+ * cada aging_interval unidades esperadas, así que ningún proceso sufre inanición.
+ * El proceso en ejecución conserva su nivel y solo lo desaloja uno estrictamente
+ * mejor; tras ejecutarse, vuelve a esperar con su prioridad base.
+ */
+void schedule_priority(process_t *processes, int n, priority_config_t *config,
+                       timeline_t *timeline);
+
+/**
+ * @brief Implementa Earliest Deadline First (EDF) para procesos de tiempo real.
+ * Preemptivo. Ejecuta el proceso listo con el deadline absoluto más cercano
+ * (arrival_time + deadline); los procesos sin deadline solo usan la CPU cuando
+ * no hay ninguno con deadline listo.
+ */
+void schedule_edf(process_t *processes, int n, timeline_t *timeline);
 
 /**
  * @brief Implementa el algoritmo Round Robin.
  * Preemptivo, basado en un quantum de tiempo.
  */
 void schedule_rr(process_t *processes, int n, int quantum, 
-                 timeline_event_t *timeline);
+                 timeline_t *timeline);
 
 /**
  * @brief Implementa el algoritmo Multi-Level Feedback Queue (MLFQ).
  * Preemptivo, usa múltiples colas con diferentes quantums y boosting periódico.
  */
 void schedule_mlfq(process_t *processes, int n, mlfq_config_t *config,
-                   timeline_event_t *timeline);
+                   timeline_t *timeline);
+
+// --- Planificadores sobre una Tabla SoA ---
+// Cada schedule_* anterior carga una proc_table_t desde el array de procesos,
+// llama a su variante _table y copia los resultados de vuelta. Las variantes
+// _table simulan sobre una tabla ya creada (por ejemplo, con proc_table_load_view
+// sobre un workload binario mapeado, sin copiar sus columnas) y dejan los
+// resultados en las columnas de estado de la tabla.
+
+void schedule_fifo_table(proc_table_t *table, timeline_t *timeline);
+void schedule_sjf_table(proc_table_t *table, timeline_t *timeline);
+void schedule_stcf_table(proc_table_t *table, timeline_t *timeline);
+void schedule_cfs_table(proc_table_t *table, cfs_config_t *config, timeline_t *timeline);
+void schedule_stride_table(proc_table_t *table, int quantum, timeline_t *timeline);
+void schedule_lottery_table(proc_table_t *table, int quantum, unsigned int seed, timeline_t *timeline);
+void schedule_priority_table(proc_table_t *table, priority_config_t *config, timeline_t *timeline);
+void schedule_edf_table(proc_table_t *table, timeline_t *timeline);
+void schedule_rr_table(proc_table_t *table, int quantum, timeline_t *timeline);
+void schedule_mlfq_table(proc_table_t *table, mlfq_config_t *config, timeline_t *timeline);
 
 #endif // ALGORITHMS_H
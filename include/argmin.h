@@ -0,0 +1,40 @@
+#ifndef ARGMIN_H
+#define ARGMIN_H
+
+// --- Kernel "eligible argmin" para la selección de STCF/SJF ---
+// Criterio (el mismo de find_shortest_remaining): entre los procesos elegibles
+// (arrival <= current_time y remaining > 0), el de menor remaining; a igualdad,
+// el de menor arrival; y a igualdad de ambos, el de menor índice.
+
+/**
+ * @brief Firma común de todas las implementaciones del kernel.
+ * @return Índice del proceso elegido, o -1 si no hay procesos elegibles.
+ */
+typedef int (*eligible_argmin_fn)(const int *arrival, const int *remaining, int n, int current_time);
+
+/**
+ * @brief Implementación seleccionada en tiempo de ejecución según la CPU
+ * (AVX2, SSE4.1 o escalar).
+ */
+int eligible_argmin(const int *arrival, const int *remaining, int n, int current_time);
+
+/**
+ * @brief Nombre de la implementación seleccionada ("avx2", "sse4.1" o "scalar").
+ */
+const char *eligible_argmin_name(void);
+
+/**
+ * @brief Implementación escalar de referencia (disponible en cualquier CPU).
+ */
+int eligible_argmin_scalar(const int *arrival, const int *remaining, int n, int current_time);
+
+#if defined(__x86_64__) || defined(__i386__)
+/**
+ * @brief Implementaciones vectoriales. Solo deben llamarse si la CPU las soporta
+ * (__builtin_cpu_supports("sse4.1") / __builtin_cpu_supports("avx2")).
+ */
+int eligible_argmin_sse41(const int *arrival, const int *remaining, int n, int current_time);
+int eligible_argmin_avx2(const int *arrival, const int *remaining, int n, int current_time);
+#endif
+
+#endif // ARGMIN_H
@@ -0,0 +1,89 @@
+#ifndef BUFFERS_H
+#define BUFFERS_H
+
+#include "scheduler.h" // Estructuras process_t y timeline_event_t
+
+struct metrics_acc;      // Acumulador de métricas (ver metrics.h)
+struct sim_control;      // Progreso y cancelación (ver sim_control.h)
+
+// --- Buffers Dinámicos (crecen con append en O(1) amortizado) ---
+
+/**
+ * @brief Conjunto de procesos de tamaño variable.
+ */
+typedef struct {
+    process_t *items;           // Procesos almacenados
+    int count;                  // Número de procesos válidos
+    int capacity;               // Capacidad reservada
+} process_set_t;
+
+/**
+ * @brief Línea de tiempo (Gráfico de Gantt) de tamaño variable.
+ * Los planificadores terminan siempre con una marca de fin (pid 0), incluida en count.
+ */
+typedef struct {
+    timeline_event_t *events;   // Segmentos de ejecución en orden cronológico
+    int count;                  // Número de eventos válidos
+    int capacity;               // Capacidad reservada
+    struct metrics_acc *stats;  // Opcional: los planificadores registran ahí cada proceso terminado (NULL = no)
+    struct sim_control *control; // Opcional: progreso publicado y cancelación cooperativa (NULL = no)
+} timeline_t;
+
+/**
+ * @brief Inicializa un conjunto vacío (no reserva memoria).
+ */
+void process_set_init(process_set_t *set);
+
+/**
+ * @brief Libera la memoria del conjunto y lo deja vacío.
+ */
+void process_set_free(process_set_t *set);
+
+/**
+ * @brief Garantiza espacio para al menos capacity procesos.
+ * Termina el programa si no hay memoria suficiente.
+ */
+void process_set_reserve(process_set_t *set, int capacity);
+
+/**
+ * @brief Agrega una copia de *process al final del conjunto.
+ */
+void process_set_append(process_set_t *set, const process_t *process);
+
+/**
+ * @brief Carga en set una copia limpia de los n procesos de original (ver reset_processes).
+ */
+void process_set_reset(process_set_t *set, process_t *original, int n);
+
+/**
+ * @brief Inicializa una línea de tiempo vacía (no reserva memoria), sin acumulador ni control.
+ */
+void timeline_init(timeline_t *timeline);
+
+/**
+ * @brief Libera la memoria de la línea de tiempo y la deja vacía.
+ */
+void timeline_free(timeline_t *timeline);
+
+/**
+ * @brief Vacía la línea de tiempo conservando la memoria reservada.
+ * Si tiene acumulador de métricas, también lo reinicia (el control no se modifica:
+ * una cancelación pedida antes de empezar sigue vigente).
+ */
+void timeline_clear(timeline_t *timeline);
+
+/**
+ * @brief Agrega un segmento al final de la línea de tiempo.
+ * Termina el programa si no hay memoria suficiente.
+ */
+void timeline_append(timeline_t *timeline, int time, int pid, int duration);
+
+/**
+ * @brief Restablece los procesos a su estado inicial para una nueva simulación.
+ * @param processes Array de trabajo para la simulación.
+ * @param n Número de procesos.
+ * @param original Array con el estado inicial.
+ */
+void reset_processes(process_t *processes, int n, process_t *original);
+
+#endif // BUFFERS_H
@@ -0,0 +1,95 @@
+#ifndef COMPACT_TIMELINE_H
+#define COMPACT_TIMELINE_H
+
+#include <stddef.h>
+#include "scheduler.h" // timeline_event_t
+#include "buffers.h"   // timeline_t
+
+// --- Línea de Tiempo Compacta (Gantt para visualizar trazas largas) ---
+// Los segmentos contiguos del mismo pid se fusionan en uno solo y cada segmento
+// se codifica como varints (LEB128) relativos al anterior:
+//   cabecera = zigzag(pid - pid anterior) << 2 | misma_duración << 1 | hay_hueco
+//   [hueco    = zigzag(time - fin del anterior)]   solo si hay_hueco
+//   [duración]                                     solo si no es misma_duración
+// En una línea de tiempo de un solo CPU los segmentos son contiguos (los huecos
+// ya son segmentos IDLE) y, con quantum, casi todos duran lo mismo: un despacho
+// típico ocupa 1-3 bytes en lugar de los 12 de timeline_event_t.
+
+/**
+ * @brief Línea de tiempo codificada, de solo agregado.
+ * El último segmento queda sin codificar (pending) para poder extenderlo.
+ */
+typedef struct {
+    unsigned char *data;        // Segmentos codificados
+    size_t size;                // Bytes usados
+    size_t capacity;            // Bytes reservados
+    int count;                  // Segmentos (después de fusionar), incluido pending
+    int end_time;               // Mayor instante de fin de un segmento
+
+    // Estado del codificador: referencia del siguiente segmento codificado
+    int prev_pid;
+    int prev_end;
+    int prev_duration;
+
+    int has_pending;
+    timeline_event_t pending;   // Último segmento, aún extensible
+} compact_timeline_t;
+
+/**
+ * @brief Iterador de los segmentos de una línea de tiempo compacta, en orden.
+ */
+typedef struct {
+    const compact_timeline_t *timeline;
+    size_t pos;                 // Siguiente byte a decodificar
+    int pid;                    // pid del último segmento decodificado
+    int end;                    // Fin del último segmento decodificado
+    int duration;               // Duración del último segmento decodificado
+    int pending_done;           // Ya se devolvió el segmento pendiente
+} compact_timeline_iter_t;
+
+/**
+ * @brief Inicializa una línea de tiempo compacta vacía (no reserva memoria).
+ */
+void compact_timeline_init(compact_timeline_t *timeline);
+
+/**
+ * @brief Libera la memoria y la deja vacía.
+ */
+void compact_timeline_free(compact_timeline_t *timeline);
+
+/**
+ * @brief Vacía la línea de tiempo conservando la memoria reservada.
+ */
+void compact_timeline_clear(compact_timeline_t *timeline);
+
+/**
+ * @brief Agrega un segmento. Si continúa sin pausa al último segmento del mismo
+ * pid, lo extiende en lugar de crear uno nuevo.
+ * Termina el programa si no hay memoria suficiente.
+ */
+void compact_timeline_append(compact_timeline_t *timeline, int time, int pid, int duration);
+
+/**
+ * @brief Reemplaza el contenido por la versión compacta de source (incluida su
+ * marca de fin, pid 0).
+ */
+void compact_timeline_build(compact_timeline_t *timeline, const timeline_t *source);
+
+/**
+ * @brief Bytes usados por los segmentos codificados (comparable con
+ * count * sizeof(timeline_event_t) de timeline_t).
+ */
+size_t compact_timeline_bytes(const compact_timeline_t *timeline);
+
+/**
+ * @brief Posiciona el iterador en el primer segmento.
+ */
+void compact_timeline_iter_init(compact_timeline_iter_t *iter, const compact_timeline_t *timeline);
+
+/**
+ * @brief Decodifica el siguiente segmento en *event.
+ * @return 1 si había un segmento, 0 al llegar al final.
+ */
+int compact_timeline_next(compact_timeline_iter_t *iter, timeline_event_t *event);
+
+#endif // COMPACT_TIMELINE_H
@@ -0,0 +1,80 @@
+#ifndef GANTT_LOD_H
+#define GANTT_LOD_H
+
+#include "compact_timeline.h" // compact_timeline_t e iterador
+
+// --- Índice Multirresolución para Dibujar el Gantt (niveles de detalle) ---
+// Divide [0, end_time) en buckets de bucket_width unidades (nivel 0, a lo sumo
+// GANTT_LOD_MAX_BUCKETS) y cada nivel superior agrupa pares del anterior. Cada
+// bucket resume sus tramos, de modo que una vista con muchas unidades de tiempo
+// por columna de píxeles se dibuja en O(columnas), sin recorrer los segmentos.
+// Para las vistas con más detalle, los puntos de control permiten saltar al
+// primer segmento visible sin decodificar la línea de tiempo desde el principio.
+
+#define GANTT_LOD_MAX_BUCKETS (1 << 18)
+#define GANTT_LOD_MAX_LEVELS 32
+#define GANTT_LOD_CHECKPOINT 256    // Segmentos entre puntos de control
+
+/**
+ * @brief Resumen de un intervalo de tiempo (un bucket o una columna de píxeles).
+ */
+typedef struct {
+    int pid;                    // pid del tramo más largo (-1 = IDLE, 0 = sin segmentos)
+    float longest;              // Duración de ese tramo dentro del intervalo
+    float busy;                 // Tiempo ocupado por procesos (pid > 0) dentro del intervalo
+    float covered;              // Tiempo resumido (con cualquier segmento, incluido IDLE)
+} gantt_summary_t;
+
+/**
+ * @brief Índice de niveles de detalle sobre una línea de tiempo compacta.
+ * Guarda un puntero a la línea de tiempo: hay que reconstruirlo si esta cambia.
+ * Si solo se mueve (copia de la estructura, mismos datos), basta con actualizar
+ * timeline: los puntos de control guardan posiciones, no la dirección original.
+ */
+typedef struct {
+    const compact_timeline_t *timeline;
+    int bucket_width;           // Unidades de tiempo por bucket del nivel 0
+    int num_levels;
+    gantt_summary_t *levels[GANTT_LOD_MAX_LEVELS]; // Nivel l: buckets de bucket_width << l unidades
+    int level_size[GANTT_LOD_MAX_LEVELS];
+
+    compact_timeline_iter_t *checkpoints; // Iterador justo antes de cada GANTT_LOD_CHECKPOINT-ésimo segmento (se usa con timeline)
+    int *checkpoint_time;       // Inicio de ese segmento
+    int num_checkpoints;
+} gantt_lod_t;
+
+/**
+ * @brief Construye el índice en una pasada sobre la línea de tiempo.
+ * No libera un índice anterior: llamar a gantt_lod_free antes de reconstruir.
+ * @return 0 si tuvo éxito, -1 si falló la asignación de memoria.
+ */
+int gantt_lod_build(gantt_lod_t *lod, const compact_timeline_t *timeline);
+
+/**
+ * @brief Libera la memoria del índice.
+ */
+void gantt_lod_free(gantt_lod_t *lod);
+
+/**
+ * @brief Posiciona iter en un segmento que empieza en time o antes; los
+ * segmentos que terminan antes de time se deben saltar al iterar.
+ */
+void gantt_lod_seek(const gantt_lod_t *lod, int time, compact_timeline_iter_t *iter);
+
+/**
+ * @brief Resume la vista [start, start + columns * units_per_column) en una
+ * entrada por columna. Usa el nivel más grueso cuyos buckets no son más
+ * anchos que una columna; si ni el nivel 0 es suficiente, recorre los segmentos
+ * visibles desde el punto de control más cercano.
+ * @param out Array de columns entradas.
+ */
+void gantt_lod_columns(const gantt_lod_t *lod, double start, double units_per_column,
+                       int columns, gantt_summary_t *out);
+
+/**
+ * @brief Intervalo "redondo" entre marcas del eje de tiempo: el menor valor
+ * 1, 2 o 5 x 10^k (y al menos 1) que no sea menor que min_interval.
+ */
+double gantt_tick_interval(double min_interval);
+
+#endif // GANTT_LOD_H
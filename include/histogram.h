@@ -0,0 +1,45 @@
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+// --- Histograma log-lineal para percentiles (estilo HDR Histogram) ---
+// Los valores en [0, 2^HISTOGRAM_SUB_BITS) tienen un bucket cada uno (exactos);
+// por encima, cada potencia de dos se divide en 2^(HISTOGRAM_SUB_BITS-1) buckets,
+// así que el error relativo de un percentil es menor que 2^-(HISTOGRAM_SUB_BITS-1)
+// (< 0.8%). La memoria es fija, sin importar cuántos valores se registren.
+
+#define HISTOGRAM_SUB_BITS 8
+#define HISTOGRAM_HALF (1 << (HISTOGRAM_SUB_BITS - 1))
+// Buckets exactos + HISTOGRAM_HALF por cada exponente hasta el del mayor int (30)
+#define HISTOGRAM_BUCKETS (2 * HISTOGRAM_HALF + HISTOGRAM_HALF * (31 - HISTOGRAM_SUB_BITS))
+
+/**
+ * @brief Histograma de enteros no negativos con memoria acotada.
+ */
+typedef struct {
+    unsigned int counts[HISTOGRAM_BUCKETS];
+    long long total;            // Valores registrados
+    int max;                    // Máximo exacto
+    int last_bucket;            // Mayor bucket no vacío (acota los recorridos)
+} histogram_t;
+
+/**
+ * @brief Inicializa un histograma vacío.
+ */
+void histogram_init(histogram_t *hist);
+
+/**
+ * @brief Registra un valor en O(1). Los valores negativos cuentan como 0.
+ */
+void histogram_record(histogram_t *hist, int value);
+
+/**
+ * @brief Percentil por rango más cercano: el menor valor v tal que al menos
+ * percentile% de los valores registrados son <= v (con la resolución del bucket).
+ * Devuelve el mayor valor equivalente del bucket, acotado por el máximo exacto.
+ * El rango se calcula en enteros, con percentile redondeado a milésimas.
+ * @param percentile En (0, 100]. Con 100 devuelve el máximo exacto.
+ * @return El percentil, o 0 si el histograma está vacío.
+ */
+int histogram_percentile(const histogram_t *hist, double percentile);
+
+#endif // HISTOGRAM_H
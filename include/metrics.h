@@ -2,12 +2,18 @@
 #define METRICS_H
 
 #include "scheduler.h" // Necesario para usar las estructuras process_t y metrics_t
+#include "buffers.h"   // timeline_t (simulación SMP)
+#include "histogram.h" // histogram_t (percentiles del acumulador)
 
 // --- Prototipo de la Función de Cálculo de Métricas ---
 
 /**
  * @brief Calcula las métricas de rendimiento globales (TAT, WT, RT promedio,
  * utilización de CPU, rendimiento y equidad) después de la simulación.
+ * Los percentiles (P50/P90/P99/P99.9/máximo) de TAT, WT y RT salen de histogramas
+ * de memoria fija (ver histogram.h), sin ordenar el array de procesos.
+ * Para los procesos con deadline calcula además la fracción de deadlines
+ * incumplidos (terminan después de arrival + deadline) y el retraso máximo.
  * * @param processes Array de procesos con resultados de simulación.
  * @param n Número de procesos.
  * @param total_time Tiempo total que duró la simulación.
@@ -16,4 +22,63 @@
 void calculate_metrics(process_t *processes, int n, int total_time,
                        metrics_t *metrics);
 
+/**
+ * @brief Calcula las métricas de una simulación multiprocesador (ver smp.h).
+ * Las métricas por proceso son las de calculate_metrics; cpu_utilization pasa a
+ * ser el promedio de los núcleos (100% = todas las CPUs ocupadas todo el tiempo)
+ * y throughput es el agregado de todas las CPUs.
+ * @param timelines Líneas de tiempo de cada CPU.
+ * @param num_cpus Número de CPUs.
+ * @param cpu_utilization Salida: utilización (%) de cada núcleo (num_cpus entradas).
+ */
+void calculate_smp_metrics(process_t *processes, int n, int total_time,
+                           const timeline_t *timelines, int num_cpus,
+                           metrics_t *metrics, double *cpu_utilization);
+
+// --- Acumulador Incremental de Métricas ---
+
+/**
+ * @brief Sumas y contadores que los planificadores actualizan al terminar cada
+ * proceso, para obtener las métricas al final de la simulación sin recorrer de
+ * nuevo el array de procesos ni buscar el tiempo total.
+ * Se conecta a una simulación con timeline.stats = &acc; el planificador lo
+ * reinicia al empezar (timeline_clear) y registra cada proceso al completarlo.
+ */
+typedef struct metrics_acc {
+    int completed;              // Procesos terminados
+    int max_completion;         // Mayor completion_time (tiempo total de la simulación)
+    long long sum_tat;          // Sumas enteras: exactas e independientes del orden
+    long long sum_wt;
+    long long sum_rt;
+    long long sum_burst;
+    long double sum_tat_squared; // Para el índice de Jain (puede superar 2^63)
+
+    int deadline_count;
+    int missed_deadlines;
+    int max_lateness;
+
+    histogram_t tat_hist;       // Percentiles (ver histogram.h)
+    histogram_t wt_hist;
+    histogram_t rt_hist;
+} metrics_acc_t;
+
+/**
+ * @brief Deja el acumulador vacío.
+ */
+void metrics_acc_reset(metrics_acc_t *acc);
+
+/**
+ * @brief Registra un proceso terminado en O(1).
+ * @param deadline Deadline relativo a la llegada (0 = sin deadline).
+ */
+void metrics_acc_add(metrics_acc_t *acc, int arrival, int burst, int start, int completion, int deadline);
+
+/**
+ * @brief Calcula las métricas acumuladas, con el mayor completion_time como
+ * tiempo total. El resultado es idéntico al de calculate_metrics sobre los mismos
+ * procesos (que sigue siendo la implementación de referencia), sin depender de n.
+ * @return El tiempo total de la simulación.
+ */
+int metrics_acc_finish(const metrics_acc_t *acc, metrics_t *metrics);
+
 #endif // METRICS_H
@@ -0,0 +1,72 @@
+#ifndef PROC_TABLE_H
+#define PROC_TABLE_H
+
+#include "scheduler.h" // Estructura process_t
+#include "workload.h"  // workload_view_t
+
+/**
+ * @brief Tabla de procesos en formato Structure-of-Arrays (SoA).
+ * Uso interno de los planificadores: cada campo es una columna contigua, de modo
+ * que los bucles de selección (que solo leen arrival y remaining) recorren
+ * únicamente los datos que necesitan. Las columnas frías (entrada y resultados)
+ * quedan separadas y solo se tocan al despachar o completar un proceso.
+ * La conversión desde/hacia process_t mantiene la API pública sin cambios.
+ * Las columnas de entrada son de solo lectura para los planificadores: al crear
+ * la tabla desde un workload binario apuntan directamente al archivo mapeado.
+ */
+typedef struct {
+    int n;                      // Número de procesos
+
+    // Columnas calientes: criterio de selección
+    const int *arrival;         // arrival_time
+    int *remaining;             // remaining_time
+
+    // Columnas calientes: estado de colas (RR / MLFQ)
+    int *queue_level;           // current_queue
+    int *quantum_used;          // time_in_current_quantum
+
+    // Columnas frías: datos de entrada y resultados
+    const int *pid;
+    const int *burst;
+    const int *priority;
+    int *start;                 // start_time (-1 si no ha comenzado)
+    int *completion;            // completion_time
+    const int *deadline;        // deadline (relativo a arrival, 0 = sin deadline)
+
+    int *storage;               // Bloque propio con las columnas (ver proc_table_free)
+} proc_table_t;
+
+/**
+ * @brief Crea la tabla a partir de un array de procesos (copia columna por columna).
+ * @return 0 si tuvo éxito, -1 si falló la asignación de memoria.
+ */
+int proc_table_load(proc_table_t *table, const process_t *processes, int n);
+
+/**
+ * @brief Crea la tabla sobre un workload binario abierto con workload_bin_open.
+ * Las columnas de entrada (pid, arrival, burst, priority y deadline) apuntan a
+ * la vista sin copiarse; solo se reservan las columnas de estado y resultados,
+ * inicializadas con proc_table_reset. La vista debe seguir abierta mientras se
+ * use la tabla.
+ * @return 0 si tuvo éxito, -1 si falló la asignación de memoria.
+ */
+int proc_table_load_view(proc_table_t *table, const workload_view_t *view);
+
+/**
+ * @brief Devuelve las columnas de estado al inicio de la simulación
+ * (remaining = burst, start = -1, sin completion, nivel ni quantum usado).
+ */
+void proc_table_reset(proc_table_t *table);
+
+/**
+ * @brief Escribe los resultados de la simulación de vuelta en el array de procesos
+ * (remaining_time, start_time, completion_time, current_queue, time_in_current_quantum).
+ */
+void proc_table_store(const proc_table_t *table, process_t *processes);
+
+/**
+ * @brief Libera la memoria de la tabla.
+ */
+void proc_table_free(proc_table_t *table);
+
+#endif // PROC_TABLE_H
@@ -0,0 +1,59 @@
+#ifndef RBTREE_H
+#define RBTREE_H
+
+/**
+ * @brief Función de orden del árbol.
+ * Devuelve un valor negativo si el proceso con índice a va antes que b.
+ * Debe ser un orden total (sin empates entre índices distintos).
+ * @param ctx Contexto del planificador (ej: la tabla de procesos).
+ */
+typedef int (*rbtree_cmp_t)(const void *ctx, int a, int b);
+
+/**
+ * @brief Árbol rojo-negro intrusivo sobre índices de procesos [0, capacity).
+ * Los enlaces viven en arrays paralelos indexados por proceso, así que insertar
+ * y eliminar no reservan memoria y cuestan O(log n). El nodo más a la izquierda
+ * (el primero según el orden) se mantiene en caché: consultarlo es O(1).
+ */
+typedef struct {
+    int *left;
+    int *right;
+    int *parent;
+    unsigned char *red;
+    int nil;                    // Centinela negro (índice capacity)
+    int root;
+    int leftmost;
+    int size;
+    rbtree_cmp_t before;        // Criterio de orden
+    const void *ctx;            // Contexto pasado al criterio de orden
+} rbtree_t;
+
+/**
+ * @brief Inicializa un árbol vacío para índices en [0, capacity).
+ * @return 0 si tuvo éxito, -1 si falló la asignación de memoria.
+ */
+int rbtree_init(rbtree_t *tree, int capacity, rbtree_cmp_t before, const void *ctx);
+
+/**
+ * @brief Libera la memoria del árbol.
+ */
+void rbtree_free(rbtree_t *tree);
+
+/**
+ * @brief Inserta el proceso con índice idx (no debe estar ya en el árbol).
+ * Su clave no debe cambiar mientras esté insertado.
+ */
+void rbtree_insert(rbtree_t *tree, int idx);
+
+/**
+ * @brief Elimina el proceso con índice idx (debe estar en el árbol).
+ */
+void rbtree_erase(rbtree_t *tree, int idx);
+
+/**
+ * @brief Primer proceso según el orden del árbol.
+ * @return Su índice, o -1 si el árbol está vacío.
+ */
+int rbtree_first(const rbtree_t *tree);
+
+#endif // RBTREE_H
@@ -0,0 +1,167 @@
+#ifndef READY_QUEUE_H
+#define READY_QUEUE_H
+
+#include "scheduler.h" // MAX_QUEUES
+
+/**
+ * @brief Función de orden de la cola de listos.
+ * Devuelve un valor negativo si el proceso con índice a debe ejecutarse antes que b.
+ * @param ctx Contexto del planificador (ej: el array de procesos).
+ */
+typedef int (*ready_queue_cmp_t)(const void *ctx, int a, int b);
+
+/**
+ * @brief Cola de listos implementada como un min-heap binario de índices de procesos.
+ * El criterio de orden lo define el planificador que la usa (STCF, SJF, ...),
+ * de modo que cada decisión de planificación cuesta O(log n).
+ */
+typedef struct {
+    int *heap;                  // Índices de procesos en orden de heap
+    int size;                   // Número de procesos en la cola
+    int capacity;               // Capacidad reservada
+    ready_queue_cmp_t before;   // Criterio de orden
+    const void *ctx;            // Contexto pasado al criterio de orden
+} ready_queue_t;
+
+/**
+ * @brief Inicializa una cola vacía con espacio para capacity procesos.
+ * @return 0 si tuvo éxito, -1 si falló la asignación de memoria.
+ */
+int ready_queue_init(ready_queue_t *queue, int capacity, ready_queue_cmp_t before, const void *ctx);
+
+/**
+ * @brief Libera la memoria de la cola.
+ */
+void ready_queue_free(ready_queue_t *queue);
+
+/**
+ * @brief Inserta el proceso con índice idx. Si la cola está llena, su capacidad se duplica.
+ */
+void ready_queue_push(ready_queue_t *queue, int idx);
+
+/**
+ * @brief Extrae el proceso que debe ejecutarse primero.
+ * @return Su índice, o -1 si la cola está vacía.
+ */
+int ready_queue_pop(ready_queue_t *queue);
+
+/**
+ * @brief Consulta el proceso que debe ejecutarse primero sin extraerlo.
+ * @return Su índice, o -1 si la cola está vacía.
+ */
+int ready_queue_peek(const ready_queue_t *queue);
+
+/**
+ * @brief Cola FIFO circular de índices de procesos con capacidad fija.
+ * Se dimensiona una sola vez (potencia de dos, para indexar con una máscara)
+ * y nunca se realoja durante una simulación: cada operación cuesta O(1).
+ */
+typedef struct {
+    int *slots;                 // Índices de procesos
+    int mask;                   // Capacidad - 1
+    int head;                   // Posición del primer elemento
+    int size;                   // Número de procesos en la cola
+} ring_queue_t;
+
+/**
+ * @brief Inicializa una cola circular vacía con espacio para al menos capacity procesos.
+ * @return 0 si tuvo éxito, -1 si falló la asignación de memoria.
+ */
+int ring_queue_init(ring_queue_t *queue, int capacity);
+
+/**
+ * @brief Libera la memoria de la cola circular.
+ */
+void ring_queue_free(ring_queue_t *queue);
+
+/**
+ * @brief Amplía la capacidad a al menos capacity procesos, conservando el orden.
+ * Para colas cuyo tamaño máximo no se conoce al inicio (ver stream_sim.h).
+ * @return 0 si tuvo éxito, -1 si falló la asignación de memoria (la cola no cambia).
+ */
+int ring_queue_grow(ring_queue_t *queue, int capacity);
+
+/**
+ * @brief Añade el proceso con índice idx al final. La capacidad debe ser suficiente.
+ */
+void ring_queue_push(ring_queue_t *queue, int idx);
+
+/**
+ * @brief Extrae el primer proceso.
+ * @return Su índice, o -1 si la cola está vacía.
+ */
+int ring_queue_pop(ring_queue_t *queue);
+
+/**
+ * @brief Colas FIFO por nivel de prioridad (MLFQ) como listas enlazadas sobre un
+ * array next[] compartido, más un bitmap de niveles no vacíos (bit i = cola Qi).
+ * Elegir el nivel de mayor prioridad es un find-first-set y el boost concatena
+ * todas las listas en Q0 en O(niveles), sin recorrer los procesos.
+ * Varias colas (ej: una por CPU) pueden compartir el mismo next[], ya que cada
+ * proceso está en una sola cola a la vez.
+ */
+typedef struct {
+    int head[MAX_QUEUES];
+    int tail[MAX_QUEUES];
+    int *next;                  // Siguiente proceso en la misma cola (-1 = fin), del llamador
+    unsigned long long bitmap;  // Niveles con al menos un proceso
+} level_queue_t;
+
+/**
+ * @brief Inicializa las colas vacías usando next (un entero por proceso) como enlaces.
+ */
+void level_queue_init(level_queue_t *queue, int *next);
+
+/**
+ * @brief Añade el proceso con índice idx al final de la cola del nivel indicado.
+ */
+void level_queue_push(level_queue_t *queue, int level, int idx);
+
+/**
+ * @brief Extrae el primer proceso de la cola de mayor prioridad no vacía.
+ * @return Su índice, o -1 si todas las colas están vacías.
+ */
+int level_queue_pop(level_queue_t *queue);
+
+/**
+ * @brief Priority Boost: concatena Q1..Qn al final de Q0 conservando el orden.
+ * @return 1 si algún proceso cambió de cola, 0 si todos estaban ya en Q0.
+ */
+int level_queue_boost(level_queue_t *queue);
+
+/**
+ * @brief Tickets de los procesos listos (lotería) en un árbol de Fenwick.
+ * Cambiar los tickets de un proceso y sortear el ganador cuestan O(log n),
+ * sin recorrer los procesos: el sorteo desciende por las sumas parciales.
+ */
+typedef struct {
+    long long *sum;             // Sumas parciales (1-indexado)
+    int size;                   // Número de procesos (índices en [0, size))
+    int top;                    // Mayor potencia de dos <= size (inicio del descenso)
+    long long total;            // Tickets totales en el árbol
+} ticket_tree_t;
+
+/**
+ * @brief Inicializa un árbol sin tickets para índices en [0, capacity).
+ * @return 0 si tuvo éxito, -1 si falló la asignación de memoria.
+ */
+int ticket_tree_init(ticket_tree_t *tree, int capacity);
+
+/**
+ * @brief Libera la memoria del árbol.
+ */
+void ticket_tree_free(ticket_tree_t *tree);
+
+/**
+ * @brief Suma delta tickets al proceso con índice idx (negativo para retirarlos).
+ */
+void ticket_tree_add(ticket_tree_t *tree, int idx, long long delta);
+
+/**
+ * @brief Proceso dueño del ticket ganador: el menor idx cuyos tickets acumulados
+ * (de 0 a idx) superan ticket.
+ * @param ticket Número en [0, total).
+ */
+int ticket_tree_find(const ticket_tree_t *tree, long long ticket);
+
+#endif // READY_QUEUE_H
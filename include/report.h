@@ -0,0 +1,15 @@
+#ifndef REPORT_H
+#define REPORT_H
+
+#include "scheduler.h" // Estructura process_t
+
+/**
+ * @brief Genera un informe de rendimiento en formato Markdown comparando todos los algoritmos.
+ * Los algoritmos se ejecutan en paralelo (un hilo por algoritmo).
+ * @param filename Nombre del archivo de salida (ej: "report.md").
+ * @param original_processes El conjunto de procesos utilizado como carga de trabajo.
+ * @param n Número de procesos.
+ */
+void generate_report(const char *filename, process_t *original_processes, int n);
+
+#endif // REPORT_H
@@ -1,9 +1,8 @@
 #ifndef SCHEDULER_H
 #define SCHEDULER_H
 
-#define MAX_PROCESSES 100           // Máximo número de procesos soportados
-#define MAX_TIMELINE_EVENTS 1000    // Máximo número de eventos para el Gráfico de Gantt
-#define MAX_QUEUES 5                // Máximo número de colas para MLFQ
+// Los conjuntos de procesos y la línea de tiempo crecen dinámicamente (ver buffers.h)
+#define MAX_QUEUES 64               // Máximo número de colas para MLFQ (una por bit del bitmap de niveles)
 
 // --- Estructuras de Datos Principales ---
 
@@ -29,6 +28,9 @@ typedef struct {
     // Campos Específicos para MLFQ
     int current_queue;          // Cola actual de prioridad en MLFQ
     int time_in_current_quantum; // Tiempo usado en el quantum actual de su cola
+
+    // Tiempo real (EDF)
+    int deadline;               // Deadline relativo a la llegada (0 = sin deadline)
 } process_t;
 
 /**
@@ -49,6 +51,33 @@ typedef struct {
     int boost_interval;         // Intervalo de tiempo para el "Priority Boost"
 } mlfq_config_t;
 
+/**
+ * @brief Estructura para la configuración del planificador justo tipo CFS (Linux).
+ */
+typedef struct {
+    int target_latency;         // Periodo en el que cada proceso listo debe ejecutarse una vez
+    int min_granularity;        // Tramo mínimo de ejecución (acota el periodo con muchos procesos)
+} cfs_config_t;
+
+/**
+ * @brief Estructura para la configuración de la planificación por prioridades.
+ */
+typedef struct {
+    int preemptive;             // 1 = un proceso listo con mejor prioridad desaloja al actual
+    int aging_interval;         // Unidades de espera que equivalen a un nivel de prioridad (0 = sin aging)
+} priority_config_t;
+
+/**
+ * @brief Percentiles de una métrica por proceso (TAT, WT o RT), en unidades de tiempo.
+ */
+typedef struct {
+    int p50;
+    int p90;
+    int p99;
+    int p999;                   // P99.9
+    int max;
+} percentiles_t;
+
 /**
  * @brief Estructura para almacenar las métricas de rendimiento globales.
  */
@@ -59,6 +88,16 @@ typedef struct {
     double cpu_utilization;
     double throughput;
     double fairness_index;      // Índice de equidad de Jain
+
+    // Deadlines (solo procesos con deadline > 0)
+    int deadline_count;         // Procesos con deadline (0 = el workload no tiene deadlines)
+    double deadline_miss_ratio; // Fracción de deadlines incumplidos (0..1)
+    double max_lateness;        // Máximo de completion - deadline absoluto (negativo = holgura)
+
+    // Latencia de cola (ver histogram.h: error relativo < 0.8%)
+    percentiles_t tat_percentiles;
+    percentiles_t wt_percentiles;
+    percentiles_t rt_percentiles;
 } metrics_t;
 
 #endif // SCHEDULER_H
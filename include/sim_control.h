@@ -0,0 +1,52 @@
+#ifndef SIM_CONTROL_H
+#define SIM_CONTROL_H
+
+#include <stdatomic.h>
+
+// --- Control de una Simulación en Otro Hilo (progreso y cancelación) ---
+// Se asocia a una línea de tiempo (timeline_t.control). Los planificadores de
+// algorithms.c revisan la cancelación al inicio de cada iteración de su bucle
+// principal y, cada SIM_CONTROL_INTERVAL iteraciones, publican el tiempo
+// simulado. Al cancelar, el planificador cierra la línea de tiempo en el
+// instante alcanzado y los procesos sin terminar quedan con completion_time 0.
+
+#define SIM_CONTROL_INTERVAL 1024
+
+/**
+ * @brief Estado compartido entre el hilo que simula y el que lo observa.
+ */
+typedef struct sim_control {
+    atomic_int cancel;          // 1 = detener la simulación lo antes posible
+    atomic_int time;            // Último tiempo simulado publicado
+    atomic_int completed;       // Procesos terminados hasta ahora
+
+    // Opcional: se llama en el hilo de la simulación después de cada publicación
+    void (*on_progress)(struct sim_control *control);
+    void *user_data;
+
+    int countdown;              // Iteraciones hasta la próxima publicación (solo el hilo que simula)
+} sim_control_t;
+
+/**
+ * @brief Inicializa el control sin progreso ni cancelación.
+ * @param on_progress Callback de progreso, o NULL.
+ */
+void sim_control_init(sim_control_t *control, void (*on_progress)(sim_control_t *), void *user_data);
+
+/**
+ * @brief Pide detener la simulación (se puede llamar desde cualquier hilo).
+ */
+void sim_control_cancel(sim_control_t *control);
+
+/**
+ * @brief Devuelve 1 si se pidió cancelar.
+ */
+int sim_control_cancelled(sim_control_t *control);
+
+/**
+ * @brief Publica el tiempo simulado y llama a on_progress. Lo usan los
+ * planificadores cada SIM_CONTROL_INTERVAL iteraciones.
+ */
+void sim_control_publish(sim_control_t *control, int time);
+
+#endif // SIM_CONTROL_H
@@ -0,0 +1,52 @@
+#ifndef SMP_H
+#define SMP_H
+
+#include "scheduler.h" // process_t y mlfq_config_t
+#include "buffers.h"   // timeline_t
+
+/**
+ * @brief Política de planificación usada en cada CPU.
+ */
+typedef enum {
+    SMP_FIFO,
+    SMP_STCF,
+    SMP_RR,
+    SMP_MLFQ
+} smp_policy_t;
+
+/**
+ * @brief Configuración de la simulación multiprocesador.
+ */
+typedef struct {
+    int num_cpus;               // Número de CPUs (>= 1)
+    smp_policy_t policy;
+    int quantum;                // Quantum para SMP_RR
+    mlfq_config_t mlfq;         // Configuración para SMP_MLFQ
+    int balance_interval;       // Balanceo periódico de carga (0 = solo al quedar una CPU ociosa)
+} smp_config_t;
+
+/**
+ * @brief Simula la carga de trabajo en num_cpus CPUs, cada una con su propia cola de listos.
+ * - Cada llegada se asigna a la CPU menos cargada (procesos en cola + en ejecución).
+ * - Una CPU que se queda sin trabajo roba el siguiente proceso de la CPU más cargada.
+ * - Cada balance_interval se migran procesos de la CPU más cargada a la menos
+ *   cargada hasta que sus cargas difieren en a lo sumo 1.
+ * Dentro de cada CPU se aplican las mismas reglas que el algoritmo de un solo
+ * CPU correspondiente; con num_cpus = 1 los resultados son idénticos.
+ * @param timelines Array de config->num_cpus líneas de tiempo inicializadas (una por CPU).
+ * @return 0 si tuvo éxito, -1 si la configuración es inválida o falló la memoria.
+ */
+int schedule_smp(process_t *processes, int n, const smp_config_t *config, timeline_t *timelines);
+
+/**
+ * @brief Nombre de una política ("FIFO", "STCF", "RR", "MLFQ").
+ */
+const char *smp_policy_name(smp_policy_t policy);
+
+/**
+ * @brief Convierte un nombre (sin distinguir mayúsculas) en una política.
+ * @return 0 si tuvo éxito, -1 si el nombre no es válido.
+ */
+int smp_parse_policy(const char *name, smp_policy_t *policy);
+
+#endif // SMP_H
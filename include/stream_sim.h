@@ -0,0 +1,58 @@
+#ifndef STREAM_SIM_H
+#define STREAM_SIM_H
+
+#include "workload_gen.h" // workload_gen_t
+#include "metrics.h"      // metrics_acc_t
+
+// --- Simulación en Streaming ---
+// Los planificadores de algorithms.c cargan el workload completo y registran una
+// línea de tiempo. Aquí los procesos llegan del generador a medida que el reloj
+// los alcanza, ocupan un lugar (slot) mientras están en el sistema y lo liberan
+// al terminar; las métricas van directamente a un metrics_acc_t. La memoria
+// depende del máximo de procesos en el sistema a la vez, no del total, así que
+// se pueden simular 10^8 procesos con carga < 1 en unos pocos MB.
+// Las decisiones son las mismas que las de schedule_fifo, schedule_sjf,
+// schedule_stcf y schedule_rr sobre el workload materializado.
+
+/**
+ * @brief Planificadores disponibles en streaming.
+ */
+typedef enum {
+    STREAM_FIFO,
+    STREAM_SJF,
+    STREAM_STCF,
+    STREAM_RR
+} stream_policy_t;
+
+/**
+ * @brief Resumen de una simulación en streaming.
+ */
+typedef struct {
+    long long processes;        // Procesos terminados
+    long long dispatches;       // Segmentos despachados (decisiones de planificación)
+    int peak_in_system;         // Máximo de procesos llegados y sin terminar a la vez
+    int end_time;               // Finalización del último proceso
+} stream_result_t;
+
+/**
+ * @brief Simula todos los procesos que quedan en gen.
+ * @param quantum Quantum de Round Robin (ignorado por las demás políticas).
+ * @param acc Acumulador de métricas: se reinicia y recibe cada proceso terminado.
+ * @param result Salida: resumen de la simulación.
+ * @return 0 si tuvo éxito, -1 si el quantum es inválido o falló la memoria.
+ */
+int simulate_stream(workload_gen_t *gen, stream_policy_t policy, int quantum,
+                    metrics_acc_t *acc, stream_result_t *result);
+
+/**
+ * @brief Nombre de una política ("FIFO", "SJF", "STCF", "RR").
+ */
+const char *stream_policy_name(stream_policy_t policy);
+
+/**
+ * @brief Convierte un nombre (sin distinguir mayúsculas) en una política.
+ * @return 0 si tuvo éxito, -1 si el nombre no es válido.
+ */
+int stream_parse_policy(const char *name, stream_policy_t *policy);
+
+#endif // STREAM_SIM_H
@@ -0,0 +1,89 @@
+#ifndef SWEEP_H
+#define SWEEP_H
+
+#include <stdio.h>
+#include "scheduler.h" // process_t, mlfq_config_t y metrics_t
+
+/**
+ * @brief Rango de valores enteros [min, max] con paso step.
+ * Un rango con step <= 0 o max < min está vacío (esa dimensión no se barre).
+ */
+typedef struct {
+    int min;
+    int max;
+    int step;
+} sweep_range_t;
+
+/**
+ * @brief Rejilla de parámetros a evaluar.
+ * Para MLFQ el quantum de cada nivel se construye como base * factor^nivel,
+ * así que la rejilla es num_queues x base x factor x boost_interval.
+ */
+typedef struct {
+    sweep_range_t rr_quantum;       // Quantums de Round Robin
+    sweep_range_t mlfq_queues;      // Número de colas MLFQ
+    sweep_range_t mlfq_quantum;     // Quantum del nivel 0
+    sweep_range_t mlfq_factor;      // Multiplicador del quantum entre niveles
+    sweep_range_t mlfq_boost;       // Intervalo de boost
+} sweep_grid_t;
+
+typedef enum {
+    SWEEP_RR,
+    SWEEP_MLFQ
+} sweep_kind_t;
+
+/**
+ * @brief Una configuración concreta de la rejilla.
+ */
+typedef struct {
+    sweep_kind_t kind;
+    int quantum;                // Solo para SWEEP_RR
+    mlfq_config_t mlfq;         // Solo para SWEEP_MLFQ
+} sweep_config_t;
+
+/**
+ * @brief Resultado de simular una configuración.
+ */
+typedef struct {
+    sweep_config_t config;
+    metrics_t metrics;
+    int total_time;
+} sweep_result_t;
+
+/**
+ * @brief Parsea un rango "min:max[:step]" o un valor único "v" (step por defecto 1).
+ * @return 0 si tuvo éxito, -1 si el texto no es un rango válido.
+ */
+int sweep_parse_range(const char *text, sweep_range_t *range);
+
+/**
+ * @brief Genera todas las configuraciones de la rejilla (primero RR, luego MLFQ).
+ * @param configs Recibe un array nuevo que el llamador libera con free().
+ * @return Número de configuraciones, o -1 si falló la asignación de memoria.
+ */
+int sweep_expand(const sweep_grid_t *grid, sweep_config_t **configs);
+
+/**
+ * @brief Número de hilos por defecto: los núcleos en línea del sistema.
+ */
+int sweep_default_threads(void);
+
+/**
+ * @brief Simula cada configuración sobre una copia del workload usando un pool
+ * de num_threads hilos con robo de trabajo. results[i] corresponde a configs[i].
+ * @return 0 si tuvo éxito, -1 si falló la asignación de memoria.
+ */
+int run_sweep(process_t *original_processes, int n, const sweep_config_t *configs, int count,
+              sweep_result_t *results, int num_threads);
+
+/**
+ * @brief Ordena los resultados por Avg TAT, luego Avg WT y Avg RT (mejor primero).
+ */
+void sort_sweep_results(sweep_result_t *results, int count);
+
+/**
+ * @brief Escribe los resultados como tabla Markdown.
+ */
+void write_sweep_table(FILE *out, const sweep_result_t *results, int count);
+
+#endif // SWEEP_H
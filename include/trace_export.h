@@ -0,0 +1,28 @@
+#ifndef TRACE_EXPORT_H
+#define TRACE_EXPORT_H
+
+#include "scheduler.h" // process_t
+#include "buffers.h"   // timeline_t
+
+// --- Exportación a Chrome Trace / Perfetto ---
+// Formato JSON de trace events (chrome://tracing, ui.perfetto.dev), con
+// 1 unidad de tiempo de la simulación = 1 µs:
+//   - Proceso "CPUs": un hilo por CPU con sus segmentos de ejecución y un
+//     contador "Cola de listos" (procesos que llegaron, no terminaron y no
+//     están en ninguna CPU).
+//   - Proceso "Procesos": un hilo por pid con los tramos en que se ejecutó.
+// La salida se escribe en streaming a través de un buffer de tamaño fijo: la
+// memoria usada no depende del número de eventos (solo de n, para el contador).
+
+#define TRACE_BUFFER_SIZE (64 * 1024)
+
+/**
+ * @brief Escribe la línea de tiempo de una simulación como Chrome trace JSON.
+ * @param processes Procesos con los resultados de la simulación (arrival y completion).
+ * @param timelines Líneas de tiempo de cada CPU (num_cpus entradas; 1 sin SMP).
+ * @return 0 si tuvo éxito, -1 si hubo un error de E/S o de memoria.
+ */
+int trace_export_chrome(const char *filename, const process_t *processes, int n,
+                        const timeline_t *timelines, int num_cpus);
+
+#endif // TRACE_EXPORT_H
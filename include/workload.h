@@ -0,0 +1,102 @@
+#ifndef WORKLOAD_H
+#define WORKLOAD_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "buffers.h" // process_set_t
+
+// --- Carga de Workloads (formato de workloads/*.txt) ---
+
+/**
+ * @brief Carga un workload en formato CSV: "PID, Arrival Time, Burst Time, Priority[, Deadline]".
+ * La columna Deadline (relativa a la llegada, >= 0) es opcional y puede omitirse
+ * línea a línea; si falta, el proceso no tiene deadline.
+ * Las líneas que empiezan con '#' y las líneas vacías se ignoran, y se toleran
+ * espacios alrededor de las comas. El archivo se mapea en memoria (mmap) y los
+ * enteros se interpretan directamente, sin scanf.
+ * Se rechazan (con el número de línea) las filas con Arrival < 0, Burst < 1 o
+ * Deadline < 0, que ningún planificador puede simular.
+ * Si el archivo empieza con WORKLOAD_BIN_MAGIC se lee en formato binario columnar,
+ * con la misma validación por proceso.
+ * Los procesos se agregan a set ya inicializados para simular (ver reset_processes).
+ * @param filename Ruta del archivo.
+ * @param set Conjunto de procesos de destino (se vacía antes de cargar).
+ * @return 0 si tuvo éxito, -1 si hubo un error de E/S o de formato.
+ */
+int load_workload(const char *filename, process_set_t *set);
+
+// --- Formato Binario Columnar ---
+// Encabezado de 32 bytes seguido de cuatro columnas contiguas de int32 little-endian,
+// en este orden: pid, arrival, burst, priority (count valores cada una).
+// Si flags incluye WORKLOAD_BIN_FLAG_DEADLINE, sigue una quinta columna: deadline.
+
+#define WORKLOAD_BIN_MAGIC "SCHEDWL1"   // 8 bytes, sin terminador
+#define WORKLOAD_BIN_VERSION 1
+#define WORKLOAD_BIN_FLAG_DEADLINE 1u   // Hay columna de deadlines
+
+/**
+ * @brief Encabezado del formato binario de workloads.
+ */
+typedef struct {
+    char magic[8];              // WORKLOAD_BIN_MAGIC
+    uint32_t version;           // WORKLOAD_BIN_VERSION
+    uint32_t flags;             // WORKLOAD_BIN_FLAG_* (los demás bits reservados, 0)
+    uint64_t count;             // Número de procesos (longitud de cada columna)
+    uint64_t reserved;          // Reservado (0), mantiene las columnas alineadas a 8 bytes
+} workload_bin_header_t;
+
+/**
+ * @brief Vista de solo lectura sobre un workload binario mapeado en memoria.
+ * Las columnas apuntan directamente al archivo mapeado (sin copias).
+ * proc_table_load_view crea sobre ella la tabla de los planificadores sin
+ * copiar las columnas de entrada (ver schedule_*_table en algorithms.h);
+ * load_workload, en cambio, las copia a process_t.
+ */
+typedef struct {
+    const int32_t *pid;
+    const int32_t *arrival;
+    const int32_t *burst;
+    const int32_t *priority;
+    const int32_t *deadline;    // NULL si el archivo no tiene columna de deadlines
+    int count;                  // Número de procesos
+    void *map;                  // Región mapeada (para workload_bin_close)
+    size_t map_size;
+} workload_view_t;
+
+/**
+ * @brief Abre un workload binario con mmap sin copiar sus columnas.
+ * @return 0 si tuvo éxito, -1 si el archivo no existe o no es un workload binario válido.
+ */
+int workload_bin_open(const char *filename, workload_view_t *view);
+
+/**
+ * @brief Comprueba que todos los procesos de la vista se pueden simular
+ * (Arrival >= 0, Burst >= 1 y Deadline >= 0), como load_workload.
+ * @return 0 si son válidos, -1 (con el número del primer proceso inválido) si no.
+ */
+int workload_bin_validate(const workload_view_t *view, const char *filename);
+
+/**
+ * @brief Indica si el archivo empieza con WORKLOAD_BIN_MAGIC.
+ * @return 1 si es un workload binario, 0 si no (o si no se puede leer).
+ */
+int workload_is_bin(const char *filename);
+
+/**
+ * @brief Libera el mapeo de una vista abierta con workload_bin_open.
+ */
+void workload_bin_close(workload_view_t *view);
+
+/**
+ * @brief Escribe n procesos en formato binario columnar.
+ * @return 0 si tuvo éxito, -1 si hubo un error de E/S.
+ */
+int workload_bin_write(const char *filename, const process_t *processes, int n);
+
+/**
+ * @brief Convierte un workload CSV (formato de los archivos en workloads/) al formato binario.
+ * @return 0 si tuvo éxito, -1 si hubo un error.
+ */
+int convert_workload(const char *csv_filename, const char *bin_filename);
+
+#endif // WORKLOAD_H
@@ -0,0 +1,109 @@
+#ifndef WORKLOAD_GEN_H
+#define WORKLOAD_GEN_H
+
+#include <limits.h>
+#include "scheduler.h" // process_t
+#include "buffers.h"   // process_set_t
+
+// --- Generador de Workloads Sintéticos ---
+// Produce procesos en orden de llegada, uno a la vez y sin memoria proporcional
+// al número de procesos: se pueden volcar a un conjunto (workload_gen_fill),
+// escribir a disco o simular en streaming (ver stream_sim.h).
+// La misma configuración (incluida la semilla) produce siempre los mismos procesos.
+
+#define WORKLOAD_GEN_MAX_PRIORITIES 64
+
+// Llegadas posteriores a este instante terminan el workload: el cuarto restante
+// del rango de int queda para terminar el trabajo pendiente sin desbordar.
+#define WORKLOAD_GEN_MAX_ARRIVAL (INT_MAX / 4 * 3)
+
+/**
+ * @brief Proceso de llegadas.
+ */
+typedef enum {
+    ARRIVAL_POISSON,            // Intervalos exponenciales con tasa constante
+    ARRIVAL_MMPP                // Poisson modulado por una cadena de Markov de dos fases (ráfagas)
+} arrival_model_t;
+
+/**
+ * @brief Distribución de las ráfagas de CPU (burst_time).
+ */
+typedef enum {
+    BURST_EXPONENTIAL,          // Geométrica (exponencial discreta) de media mean_burst
+    BURST_PARETO,               // Pareto de índice pareto_alpha (cola pesada), truncada en max_burst
+    BURST_BIMODAL               // Mezcla de trabajos cortos y largos
+} burst_model_t;
+
+/**
+ * @brief Parámetros del generador (ver workload_gen_default_config).
+ */
+typedef struct {
+    long long count;            // Procesos a generar
+    unsigned long long seed;    // Semilla (cualquier valor, incluido 0)
+    double utilization;         // Carga ofrecida: tasa de llegadas * mean_burst (> 0)
+
+    arrival_model_t arrivals;
+    double mmpp_ratio;          // MMPP: tasa de la fase de ráfaga / tasa de la fase tranquila (>= 1)
+    double mmpp_phase;          // MMPP: duración media de cada fase, en unidades de tiempo
+
+    burst_model_t bursts;
+    double mean_burst;          // Media de burst_time (>= 1)
+    double pareto_alpha;        // Pareto: índice de cola (> 1; <= 2 = varianza infinita)
+    double bimodal_long_fraction; // Bimodal: fracción de trabajos largos (0..1)
+    double bimodal_ratio;       // Bimodal: media larga / media corta (>= 1)
+    int max_burst;              // Tope de burst_time (solo Pareto)
+
+    int num_priorities;         // Prioridades 1..num_priorities (<= WORKLOAD_GEN_MAX_PRIORITIES)
+    double priority_skew;       // Zipf: P(k) proporcional a 1 / k^skew (0 = uniforme)
+} workload_gen_config_t;
+
+/**
+ * @brief Estado del generador: O(1) en memoria, independiente de count.
+ */
+typedef struct {
+    workload_gen_config_t config;
+    unsigned long long state;   // xorshift64*
+    long long generated;        // Procesos ya producidos
+    double clock;               // Instante de la última llegada (continuo)
+    double rate;                // Tasa de llegadas de la fase actual
+    int bursting;               // MMPP: 1 = fase de ráfaga
+    double phase_end;           // MMPP: fin de la fase actual
+    double short_mean;          // Bimodal: media de los trabajos cortos
+    double pareto_min;          // Pareto: escala x_m
+    double priority_cdf[WORKLOAD_GEN_MAX_PRIORITIES];
+} workload_gen_t;
+
+/**
+ * @brief Configuración por defecto: 1000 procesos, Poisson al 90% de carga,
+ * ráfagas exponenciales de media 10, 5 prioridades uniformes, semilla 42.
+ */
+void workload_gen_default_config(workload_gen_config_t *config);
+
+/**
+ * @brief Prepara el generador para producir el workload de config desde el principio.
+ * @return 0 si tuvo éxito, -1 si algún parámetro está fuera de rango.
+ */
+int workload_gen_init(workload_gen_t *gen, const workload_gen_config_t *config);
+
+/**
+ * @brief Produce el siguiente proceso (pid consecutivos desde 1, llegadas no
+ * decrecientes), listo para simular (remaining_time = burst_time, start_time = -1).
+ * @return 1 si produjo un proceso, 0 si el workload terminó (count procesos o
+ * una llegada posterior a WORKLOAD_GEN_MAX_ARRIVAL).
+ */
+int workload_gen_next(workload_gen_t *gen, process_t *process);
+
+/**
+ * @brief Agrega a set todos los procesos que quedan por generar.
+ * @return Número de procesos agregados.
+ */
+int workload_gen_fill(workload_gen_t *gen, process_set_t *set);
+
+/**
+ * @brief Escribe los procesos que quedan por generar en formato CSV (el de
+ * los archivos de workloads/), uno por línea y sin guardarlos en memoria.
+ * @return Número de procesos escritos, o -1 si hubo un error de E/S.
+ */
+long long workload_gen_write_csv(workload_gen_t *gen, const char *filename);
+
+#endif // WORKLOAD_GEN_H
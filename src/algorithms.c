@@ -3,151 +3,272 @@
 #include <string.h>
 #include "../include/scheduler.h"
 #include "../include/algorithms.h" // Se asume que este .h incluye los prototipos de las funciones schedule_*
+#include "../include/ready_queue.h"
+#include "../include/proc_table.h"
+#include "../include/argmin.h"
+#include "../include/rbtree.h"
+#include "../include/metrics.h"
+#include "../include/sim_control.h"
+
+// Todos los planificadores trabajan sobre una tabla SoA (proc_table_t): schedule_X
+// la carga desde el array process_t, simula con schedule_X_table y copia los
+// resultados de vuelta al final.
 
 // --- Funciones de Utilidad (Necesarias para qsort en C) ---
 
 /**
- * @brief Función de comparación para qsort: ordena por arrival_time.
- * Usada principalmente en FIFO.
+ * @brief Función de comparación para qsort sobre claves de 64 bits.
  */
-int compare_arrival_time(const void *a, const void *b) {
-    return ((process_t*)a)->arrival_time - ((process_t*)b)->arrival_time;
+static int compare_long_long(const void *a, const void *b) {
+    long long x = *(const long long *)a;
+    long long y = *(const long long *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Construye la lista de llegadas: los índices de los procesos ordenados por
+ * arrival_time y, a igualdad, por índice (orden estable).
+ * @param pending_only Si es distinto de 0, solo incluye procesos con remaining_time > 0.
+ * @param count Salida: número de índices en la lista.
+ * @return Array de índices (liberar con free), o NULL si falla la asignación.
+ */
+static int *build_arrival_order(const proc_table_t *table, int pending_only, int *count) {
+    int n = table->n;
+    long long *keys = malloc((n > 0 ? n : 1) * sizeof(long long));
+    int *order = malloc((n > 0 ? n : 1) * sizeof(int));
+    if (!keys || !order) {
+        perror("Fallo en la asignación de memoria para la lista de llegadas");
+        free(keys);
+        free(order);
+        return NULL;
+    }
+
+    // Clave = (arrival_time, índice): qsort sobre ella da un orden estable
+    int m = 0;
+    for (int i = 0; i < n; i++) {
+        if (!pending_only || table->remaining[i] > 0) {
+            keys[m++] = (long long)table->arrival[i] * 4294967296LL + i;
+        }
+    }
+    qsort(keys, m, sizeof(long long), compare_long_long);
+    for (int i = 0; i < m; i++) {
+        order[i] = (int)(keys[i] & 0xFFFFFFFFLL); // Los 32 bits bajos son el índice
+    }
+
+    free(keys);
+    *count = m;
+    return order;
+}
+
+/**
+ * @brief Marca el proceso idx como terminado en el instante time y, si la línea de
+ * tiempo tiene un acumulador de métricas (ver metrics_acc_t), lo registra en él.
+ */
+static inline void complete_process(proc_table_t *table, int idx, int time, timeline_t *timeline) {
+    table->completion[idx] = time;
+    if (timeline->stats) {
+        metrics_acc_add(timeline->stats, table->arrival[idx], table->burst[idx],
+                        table->start[idx], time, table->deadline[idx]);
+    }
+    if (timeline->control) {
+        atomic_fetch_add_explicit(&timeline->control->completed, 1, memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Punto de control al inicio de cada iteración del bucle principal: si la
+ * línea de tiempo tiene un sim_control_t, publica cada tanto el tiempo simulado.
+ * @return 1 si se pidió cancelar (el planificador sale del bucle y cierra la línea de tiempo).
+ */
+static inline int simulation_cancelled(timeline_t *timeline, int time) {
+    sim_control_t *control = timeline->control;
+    if (!control) return 0;
+    if (--control->countdown <= 0) sim_control_publish(control, time);
+    return atomic_load_explicit(&control->cancel, memory_order_relaxed);
 }
 
 // --- Algoritmo 1: FIFO (First In First Out) ---
 
-void schedule_fifo(process_t *processes, int n, timeline_event_t *timeline) {
+void schedule_fifo_table(proc_table_t *table, timeline_t *timeline) {
     int current_time = 0;
-    int timeline_idx = 0;
-    
-    // 1. Clonar y ordenar los procesos por tiempo de llegada (arrival_time)
-    process_t *sorted_processes = malloc(n * sizeof(process_t));
-    if (!sorted_processes) {
-        perror("Fallo en la asignación de memoria para FIFO");
-        return;
-    }
-    memcpy(sorted_processes, processes, n * sizeof(process_t));
-    qsort(sorted_processes, n, sizeof(process_t), compare_arrival_time);
-    
+    int num_arrivals = 0;
+
+    timeline_clear(timeline);
+
+    // 1. Ordenar los índices de los procesos por tiempo de llegada (arrival_time)
+    int *order = build_arrival_order(table, 0, &num_arrivals);
+    if (!order) return;
+
     // 2. Simulación
-    for (int i = 0; i < n; i++) {
-        process_t *p = &sorted_processes[i];
+    for (int i = 0; i < num_arrivals && !simulation_cancelled(timeline, current_time); i++) {
+        int idx = order[i];
 
         // Manejar el tiempo de inactividad (IDLE) si el proceso no ha llegado
-        if (current_time < p->arrival_time) {
+        if (current_time < table->arrival[idx]) {
             // Registrar tiempo de inactividad
-            timeline[timeline_idx].time = current_time;
-            timeline[timeline_idx].pid = -1; // IDLE
-            timeline[timeline_idx].duration = p->arrival_time - current_time;
-            timeline_idx++;
-            current_time = p->arrival_time;
+            timeline_append(timeline, current_time, -1, table->arrival[idx] - current_time); // IDLE
+            current_time = table->arrival[idx];
         }
 
         // 3. Ejecutar el proceso (No preemptivo)
-        p->start_time = current_time;
-        p->completion_time = current_time + p->burst_time;
-        current_time = p->completion_time;
+        table->start[idx] = current_time;
+        current_time += table->burst[idx];
+        complete_process(table, idx, current_time, timeline);
 
         // 4. Registrar evento en la línea de tiempo
-        timeline[timeline_idx].time = p->start_time;
-        timeline[timeline_idx].pid = p->pid;
-        timeline[timeline_idx].duration = p->burst_time;
-        timeline_idx++;
-        
-        // 5. Actualizar los resultados en el array original
-        for (int j = 0; j < n; j++) {
-            if (processes[j].pid == p->pid) {
-                processes[j].start_time = p->start_time;
-                processes[j].completion_time = p->completion_time;
-                break;
-            }
-        }
+        timeline_append(timeline, table->start[idx], table->pid[idx], table->burst[idx]);
     }
-    
-    // 6. Finalizar la línea de tiempo
-    timeline[timeline_idx].time = current_time;
-    timeline[timeline_idx].pid = 0; // Marca de fin
-    timeline[timeline_idx].duration = 0;
 
-    free(sorted_processes);
+    // 5. Finalizar la línea de tiempo
+    timeline_append(timeline, current_time, 0, 0); // Marca de fin
+
+    free(order);
+}
+
+void schedule_fifo(process_t *processes, int n, timeline_t *timeline) {
+    proc_table_t table;
+    if (proc_table_load(&table, processes, n) != 0) {
+        timeline_clear(timeline);
+        return;
+    }
+    schedule_fifo_table(&table, timeline);
+    proc_table_store(&table, processes);
+    proc_table_free(&table);
 }
 
 // -----------------------------------------------------------------
 
 /**
  * @brief Función de utilidad para encontrar el proceso elegible más corto.
- * Usada por SJF (solo entre arribados) y STCF (preemptivo).
+ * Usada por la versión de referencia de STCF. Solo recorre las columnas
+ * calientes (arrival y remaining) de la tabla, con el kernel vectorial
+ * eligible_argmin (AVX2/SSE4.1/escalar según la CPU).
+ * @return Índice del proceso elegido, o -1 si no hay procesos elegibles.
  */
-process_t *find_shortest_remaining(process_t *processes, int n, int current_time) {
-    process_t *shortest = NULL;
-    int min_remaining = 2147483647; // MAX_INT
+static int find_shortest_remaining(const proc_table_t *table, int current_time) {
+    return eligible_argmin(table->arrival, table->remaining, table->n, current_time);
+}
 
-    for (int i = 0; i < n; i++) {
-        // Criterio de elegibilidad: ha llegado y no ha terminado
-        if (processes[i].arrival_time <= current_time && processes[i].remaining_time > 0) {
-            if (processes[i].remaining_time < min_remaining) {
-                min_remaining = processes[i].remaining_time;
-                shortest = &processes[i];
-            }
-            // Criterio de desempate: Si el tiempo restante es igual, elegir el de menor arrival_time
-            else if (processes[i].remaining_time == min_remaining && 
-                     processes[i].arrival_time < shortest->arrival_time) {
-                shortest = &processes[i];
-            }
-        }
+/**
+ * @brief Criterio de orden de la cola de listos para SJF y STCF.
+ * Mismo criterio que find_shortest_remaining: menor remaining_time, luego menor
+ * arrival_time y, por último, menor índice (el primero que encontraría el recorrido lineal).
+ */
+static int compare_shortest_remaining(const void *ctx, int a, int b) {
+    const proc_table_t *table = ctx;
+
+    if (table->remaining[a] != table->remaining[b]) {
+        return table->remaining[a] < table->remaining[b] ? -1 : 1;
+    }
+    if (table->arrival[a] != table->arrival[b]) {
+        return table->arrival[a] < table->arrival[b] ? -1 : 1;
     }
-    return shortest;
+    return a - b;
 }
 
 // --- Algoritmo 2: SJF (Shortest Job First) ---
 
-void schedule_sjf(process_t *processes, int n, timeline_event_t *timeline) {
-    // SJF es no preemptivo. Se puede implementar de forma similar a FIFO, 
-    // pero en el punto de selección, se elige el trabajo más corto de entre los *ya llegados*.
-    // Pista: Usa la lógica de find_shortest_remaining y una variable para 
-    // marcar los procesos completados, ya que no se pueden ordenar de antemano.
-    
-    printf("SJF no implementado. Usar find_shortest_remaining y simulación basada en tiempo.\n");
-    // Implementación requerida...
+void schedule_sjf_table(proc_table_t *table, timeline_t *timeline) {
+    // SJF es no preemptivo: en cada finalización se elige, entre los procesos ya
+    // llegados, el de menor burst (remaining_time == burst_time antes de ejecutarse).
+    int current_time = 0;
+    int num_arrivals = 0;
+    int next = 0;
+    ready_queue_t ready;
+
+    timeline_clear(timeline);
+
+    int *arrivals = build_arrival_order(table, 1, &num_arrivals);
+    if (!arrivals || ready_queue_init(&ready, num_arrivals, compare_shortest_remaining, table) != 0) {
+        free(arrivals);
+        return;
+    }
+
+    while ((next < num_arrivals || ready.size > 0) && !simulation_cancelled(timeline, current_time)) {
+        // 1. Admitir en la cola de listos todos los procesos que ya llegaron
+        while (next < num_arrivals && table->arrival[arrivals[next]] <= current_time) {
+            ready_queue_push(&ready, arrivals[next++]);
+        }
+
+        // 2. Sin procesos listos: saltar a la siguiente llegada (IDLE)
+        if (ready.size == 0) {
+            int next_arrival = table->arrival[arrivals[next]];
+            timeline_append(timeline, current_time, -1, next_arrival - current_time); // IDLE
+            current_time = next_arrival;
+            continue;
+        }
+
+        // 3. Ejecutar el trabajo más corto hasta completarse
+        int idx = ready_queue_pop(&ready);
+        table->start[idx] = current_time;
+        timeline_append(timeline, current_time, table->pid[idx], table->remaining[idx]);
+
+        current_time += table->remaining[idx];
+        table->remaining[idx] = 0;
+        complete_process(table, idx, current_time, timeline);
+    }
+
+    // 4. Finalizar la línea de tiempo
+    timeline_append(timeline, current_time, 0, 0);
+
+    ready_queue_free(&ready);
+    free(arrivals);
+}
+
+void schedule_sjf(process_t *processes, int n, timeline_t *timeline) {
+    proc_table_t table;
+    if (proc_table_load(&table, processes, n) != 0) {
+        timeline_clear(timeline);
+        return;
+    }
+    schedule_sjf_table(&table, timeline);
+    proc_table_store(&table, processes);
+    proc_table_free(&table);
 }
 
 // --- Algoritmo 3: STCF (Shortest Time to Completion First) ---
 
-void schedule_stcf(process_t *processes, int n, timeline_event_t *timeline) {
+/**
+ * @brief Versión de referencia de STCF: avanza el reloj una unidad a la vez.
+ * Su costo crece con la suma de los bursts; se conserva para validar el motor
+ * por eventos (schedule_stcf), que debe producir exactamente la misma salida.
+ */
+void schedule_stcf_tick(process_t *processes, int n, timeline_t *timeline) {
     int current_time = 0;
     int completed_processes = 0;
-    int timeline_idx = 0;
-    process_t *current_process = NULL;
+    int current_idx = -1;
     int total_burst = 0;
+    proc_table_t table;
+
+    timeline_clear(timeline);
+    if (proc_table_load(&table, processes, n) != 0) return;
 
     for (int i = 0; i < n; i++) {
-        total_burst += processes[i].burst_time;
+        total_burst += table.burst[i];
     }
 
     // Usar una marca de tiempo que garantice la finalización si no hay más procesos
     int max_simulation_time = total_burst + 100; 
 
-    while (completed_processes < n && current_time < max_simulation_time) {
+    while (completed_processes < n && current_time < max_simulation_time &&
+           !simulation_cancelled(timeline, current_time)) {
         // 1. Encontrar el proceso elegible con el menor tiempo restante
-        process_t *next_process = find_shortest_remaining(processes, n, current_time);
+        int next_idx = find_shortest_remaining(&table, current_time);
 
         // 2. Manejo de IDLE o Fin de Simulación
-        if (!next_process) {
+        if (next_idx == -1) {
             if (completed_processes == n) break; // Terminar
             
             // Avanzar al tiempo de llegada del siguiente proceso
             int next_arrival = max_simulation_time;
             for (int i = 0; i < n; i++) {
-                if (processes[i].remaining_time > 0 && processes[i].arrival_time < next_arrival) {
-                    next_arrival = processes[i].arrival_time;
+                if (table.remaining[i] > 0 && table.arrival[i] < next_arrival) {
+                    next_arrival = table.arrival[i];
                 }
             }
             if (next_arrival <= max_simulation_time && next_arrival > current_time) {
                 // Registrar IDLE
-                timeline[timeline_idx].time = current_time;
-                timeline[timeline_idx].pid = -1; // IDLE
-                timeline[timeline_idx].duration = next_arrival - current_time;
-                timeline_idx++;
+                timeline_append(timeline, current_time, -1, next_arrival - current_time); // IDLE
                 current_time = next_arrival;
                 continue;
             } else {
@@ -157,55 +278,1087 @@ void schedule_stcf(process_t *processes, int n, timeline_event_t *timeline) {
         }
         
         // 3. Manejo de Preempción / Inicio de Ejecución
-        if (next_process != current_process) {
+        if (next_idx != current_idx) {
             // Iniciar un nuevo segmento en el Gráfico de Gantt
-            timeline[timeline_idx].time = current_time;
-            timeline[timeline_idx].pid = next_process->pid;
-            timeline[timeline_idx].duration = 0; // Se actualizará en el paso de tiempo
-            timeline_idx++;
+            timeline_append(timeline, current_time, table.pid[next_idx], 0); // Se extiende en el paso de tiempo
 
-            if (next_process->start_time == -1) {
-                next_process->start_time = current_time;
+            if (table.start[next_idx] == -1) {
+                table.start[next_idx] = current_time;
             }
         }
 
-        current_process = next_process;
+        current_idx = next_idx;
 
         // 4. Ejecutar por una unidad de tiempo
-        current_process->remaining_time--;
-        timeline[timeline_idx - 1].duration++; // Extender el segmento actual
+        table.remaining[current_idx]--;
+        timeline->events[timeline->count - 1].duration++; // Extender el segmento actual
         current_time++;
 
         // 5. Manejar la finalización del proceso
-        if (current_process->remaining_time == 0) {
-            current_process->completion_time = current_time;
+        if (table.remaining[current_idx] == 0) {
+            complete_process(&table, current_idx, current_time, timeline);
             completed_processes++;
-            current_process = NULL; // Forzar la re-evaluación del planificador
+            current_idx = -1; // Forzar la re-evaluación del planificador
+        }
+    }
+
+    // 6. Finalizar la línea de tiempo
+    timeline_append(timeline, current_time, 0, 0);
+
+    proc_table_store(&table, processes);
+    proc_table_free(&table);
+}
+
+/**
+ * @brief STCF por eventos discretos.
+ * Entre dos eventos (llegada o finalización) la decisión de STCF no puede cambiar:
+ * el proceso en ejecución solo reduce su remaining_time y los demás no cambian.
+ * Por eso el reloj salta directamente al siguiente evento y el costo depende del
+ * número de llegadas y finalizaciones, no de la longitud de los bursts.
+ * Las llegadas se toman de una lista ordenada y los procesos listos viven en un
+ * min-heap, así que cada decisión cuesta O(log n).
+ * La línea de tiempo y los resultados son idénticos a los de schedule_stcf_tick.
+ */
+void schedule_stcf_table(proc_table_t *table, timeline_t *timeline) {
+    int current_time = 0;
+    int num_arrivals = 0;
+    int next = 0;
+    int current_idx = -1;
+    ready_queue_t ready;
+
+    timeline_clear(timeline);
+
+    int *arrivals = build_arrival_order(table, 1, &num_arrivals);
+    if (!arrivals || ready_queue_init(&ready, num_arrivals, compare_shortest_remaining, table) != 0) {
+        free(arrivals);
+        return;
+    }
+
+    while ((next < num_arrivals || ready.size > 0) && !simulation_cancelled(timeline, current_time)) {
+        // 1. Admitir las llegadas hasta el instante actual
+        while (next < num_arrivals && table->arrival[arrivals[next]] <= current_time) {
+            ready_queue_push(&ready, arrivals[next++]);
+        }
+        int next_arrival = next < num_arrivals ? table->arrival[arrivals[next]] : -1;
+
+        // 2. Sin procesos elegibles: saltar a la siguiente llegada (IDLE)
+        if (ready.size == 0) {
+            timeline_append(timeline, current_time, -1, next_arrival - current_time); // IDLE
+            current_time = next_arrival;
+            continue;
+        }
+
+        // 3. Preempción / Inicio de un nuevo segmento
+        // El proceso en ejecución permanece en la raíz del heap: al ejecutarse solo
+        // disminuye su clave, por lo que la propiedad de heap se conserva.
+        int idx = ready_queue_peek(&ready);
+        if (idx != current_idx) {
+            timeline_append(timeline, current_time, table->pid[idx], 0);
+
+            if (table->start[idx] == -1) {
+                table->start[idx] = current_time;
+            }
+        }
+        current_idx = idx;
+
+        // 4. Ejecutar hasta la siguiente llegada o hasta terminar
+        int run = table->remaining[idx];
+        if (next_arrival != -1 && next_arrival - current_time < run) {
+            run = next_arrival - current_time;
+        }
+        table->remaining[idx] -= run;
+        timeline->events[timeline->count - 1].duration += run;
+        current_time += run;
+
+        // 5. Manejar la finalización del proceso
+        if (table->remaining[idx] == 0) {
+            complete_process(table, idx, current_time, timeline);
+            ready_queue_pop(&ready);
+            current_idx = -1;
         }
     }
 
     // 6. Finalizar la línea de tiempo
-    timeline[timeline_idx].time = current_time;
-    timeline[timeline_idx].pid = 0;
-    timeline[timeline_idx].duration = 0;
+    timeline_append(timeline, current_time, 0, 0);
+
+    ready_queue_free(&ready);
+    free(arrivals);
+}
+
+void schedule_stcf(process_t *processes, int n, timeline_t *timeline) {
+    proc_table_t table;
+    if (proc_table_load(&table, processes, n) != 0) {
+        timeline_clear(timeline);
+        return;
+    }
+    schedule_stcf_table(&table, timeline);
+    proc_table_store(&table, processes);
+    proc_table_free(&table);
+}
+
+// --- Algoritmo 6: CFS (Completely Fair Scheduler) ---
+
+#define CFS_NICE_0_WEIGHT 1024
+#define CFS_VRUNTIME_SHIFT 16   // vruntime en punto fijo: 1 unidad de tiempo = 2^16
+
+/**
+ * @brief Peso de cada valor nice (-20..19), igual que sched_prio_to_weight de Linux:
+ * cada nivel de nice cambia la proporción de CPU en ~10%.
+ * Los planificadores de reparto proporcional (CFS, stride, lotería) lo usan
+ * como número de tickets de cada proceso.
+ */
+static const int nice_to_weight[40] = {
+    88761, 71755, 56483, 46273, 36291,
+    29154, 23254, 18705, 14949, 11916,
+     9548,  7620,  6100,  4904,  3906,
+     3121,  2501,  1991,  1586,  1277,
+     1024,   820,   655,   526,   423,
+      335,   272,   215,   172,   137,
+      110,    87,    70,    56,    45,
+       36,    29,    23,    18,    15
+};
+
+static int nice_weight(int priority) {
+    int nice = priority < -20 ? -20 : (priority > 19 ? 19 : priority);
+    return nice_to_weight[nice + 20];
+}
+
+/**
+ * @brief Contexto del árbol de CFS: clave (vruntime, orden de inserción).
+ */
+typedef struct {
+    const long long *vruntime;
+    const long long *seq;
+} cfs_keys_t;
+
+static int compare_vruntime(const void *ctx, int a, int b) {
+    const cfs_keys_t *keys = ctx;
+    if (keys->vruntime[a] != keys->vruntime[b]) return keys->vruntime[a] < keys->vruntime[b] ? -1 : 1;
+    // A igual vruntime, el que se insertó antes (FIFO)
+    return keys->seq[a] < keys->seq[b] ? -1 : (keys->seq[a] > keys->seq[b]);
+}
+
+/**
+ * @brief CFS por despachos.
+ * Los procesos listos viven en un árbol rojo-negro ordenado por vruntime, así
+ * que elegir el siguiente (el más a la izquierda) es O(1) y reinsertarlo O(log n).
+ * - Cada proceso ejecuta un tramo proporcional a su peso dentro del periodo:
+ *   periodo = max(target_latency, procesos_listos * min_granularity) y
+ *   tramo = max(min_granularity, periodo * peso / peso_total).
+ * - Tras ejecutar run unidades, su vruntime avanza run * 1024 / peso.
+ * - Un proceso nuevo entra con el min_vruntime actual, para no acaparar la CPU.
+ * Las llegadas no desalojan: se consideran al terminar el tramo en curso.
+ */
+void schedule_cfs_table(proc_table_t *table, cfs_config_t *config, timeline_t *timeline) {
+    int n = table->n;
+    int current_time = 0;
+    int num_arrivals = 0;
+    int next = 0;
+    int current_idx = -1;
+    long long next_seq = 0;
+    long long min_vruntime = 0;
+    long long total_weight = 0; // Peso de los procesos listos, incluido el que se ejecuta
+    rbtree_t tree;
+
+    timeline_clear(timeline);
+    if (config->target_latency < 1 || config->min_granularity < 1) {
+        fprintf(stderr, "CFS: target_latency y min_granularity deben ser >= 1\n");
+        return;
+    }
+
+    int *arrivals = build_arrival_order(table, 1, &num_arrivals);
+    long long *vruntime = malloc((n > 0 ? n : 1) * sizeof(long long));
+    long long *seq = malloc((n > 0 ? n : 1) * sizeof(long long));
+    int *weight = malloc((n > 0 ? n : 1) * sizeof(int));
+    cfs_keys_t keys = {vruntime, seq};
+    int allocated = arrivals && vruntime && seq && weight;
+    if (!allocated) perror("Fallo en la asignación de memoria para CFS");
+    if (!allocated || rbtree_init(&tree, n, compare_vruntime, &keys) != 0) {
+        free(arrivals);
+        free(vruntime);
+        free(seq);
+        free(weight);
+        return;
+    }
+
+    while ((next < num_arrivals || tree.size > 0) && !simulation_cancelled(timeline, current_time)) {
+        // 1. Admitir las llegadas con el min_vruntime actual
+        while (next < num_arrivals && table->arrival[arrivals[next]] <= current_time) {
+            int idx = arrivals[next++];
+            weight[idx] = nice_weight(table->priority[idx]);
+            vruntime[idx] = min_vruntime;
+            seq[idx] = next_seq++;
+            total_weight += weight[idx];
+            rbtree_insert(&tree, idx);
+        }
+
+        // 2. Sin procesos listos: saltar a la siguiente llegada (IDLE)
+        if (tree.size == 0) {
+            int next_arrival = table->arrival[arrivals[next]];
+            timeline_append(timeline, current_time, -1, next_arrival - current_time); // IDLE
+            current_time = next_arrival;
+            current_idx = -1;
+            continue;
+        }
+
+        // 3. Elegir el proceso con menor vruntime
+        int idx = rbtree_first(&tree);
+        rbtree_erase(&tree, idx);
+        if (idx != current_idx) {
+            timeline_append(timeline, current_time, table->pid[idx], 0);
+
+            if (table->start[idx] == -1) {
+                table->start[idx] = current_time;
+            }
+        }
+        current_idx = idx;
+
+        // 4. Tramo proporcional a su peso dentro del periodo
+        long long nr_running = tree.size + 1;
+        long long period = config->target_latency;
+        if (nr_running * config->min_granularity > period) {
+            period = nr_running * config->min_granularity;
+        }
+        long long slice = period * weight[idx] / total_weight;
+        if (slice < config->min_granularity) slice = config->min_granularity;
+        int run = slice < table->remaining[idx] ? (int)slice : table->remaining[idx];
+
+        table->remaining[idx] -= run;
+        timeline->events[timeline->count - 1].duration += run;
+        current_time += run;
+        vruntime[idx] += ((long long)run << CFS_VRUNTIME_SHIFT) * CFS_NICE_0_WEIGHT / weight[idx];
+
+        // 5. min_vruntime solo avanza: mínimo entre el proceso actual y el primero del árbol
+        long long candidate = vruntime[idx];
+        int first = rbtree_first(&tree);
+        if (first != -1 && vruntime[first] < candidate) candidate = vruntime[first];
+        if (candidate > min_vruntime) min_vruntime = candidate;
+
+        // 6. Finalización o reinserción con su nuevo vruntime
+        if (table->remaining[idx] == 0) {
+            complete_process(table, idx, current_time, timeline);
+            total_weight -= weight[idx];
+        } else {
+            seq[idx] = next_seq++;
+            rbtree_insert(&tree, idx);
+        }
+    }
+
+    // 7. Finalizar la línea de tiempo
+    timeline_append(timeline, current_time, 0, 0);
+
+    rbtree_free(&tree);
+    free(weight);
+    free(seq);
+    free(vruntime);
+    free(arrivals);
+}
+
+void schedule_cfs(process_t *processes, int n, cfs_config_t *config, timeline_t *timeline) {
+    proc_table_t table;
+    if (proc_table_load(&table, processes, n) != 0) {
+        timeline_clear(timeline);
+        return;
+    }
+    schedule_cfs_table(&table, config, timeline);
+    proc_table_store(&table, processes);
+    proc_table_free(&table);
+}
+
+// --- Algoritmo 7: Stride Scheduling ---
+
+#define STRIDE_ONE (1LL << 24) // Numerador del stride: stride = STRIDE_ONE / tickets
+
+/**
+ * @brief Contexto de la cola de stride: clave (pass, orden de inserción).
+ */
+typedef struct {
+    const long long *pass;
+    const long long *seq;
+} stride_keys_t;
+
+static int compare_pass(const void *ctx, int a, int b) {
+    const stride_keys_t *keys = ctx;
+    if (keys->pass[a] != keys->pass[b]) return keys->pass[a] < keys->pass[b] ? -1 : 1;
+    // A igual pass, el que se insertó antes (FIFO)
+    return keys->seq[a] < keys->seq[b] ? -1 : (keys->seq[a] > keys->seq[b]);
+}
+
+/**
+ * @brief Stride scheduling por despachos (Waldspurger).
+ * Los procesos listos viven en un min-heap ordenado por pass: cada despacho
+ * ejecuta un quantum (o lo que le quede) del proceso con menor pass y le suma
+ * stride * run, con stride = STRIDE_ONE / tickets. Elegir y reinsertar cuesta O(log n).
+ * Un proceso nuevo entra con pass = min_pass + stride, para no acaparar la CPU
+ * con el pass atrasado. Las llegadas ocurridas durante el quantum entran antes
+ * que el proceso desalojado.
+ */
+void schedule_stride_table(proc_table_t *table, int quantum, timeline_t *timeline) {
+    int n = table->n;
+    int current_time = 0;
+    int num_arrivals = 0;
+    int next = 0;
+    int current_idx = -1;
+    long long next_seq = 0;
+    long long min_pass = 0;
+    int preempted = -1;         // Proceso desalojado pendiente de reinsertar
+    ready_queue_t ready;
+
+    timeline_clear(timeline);
+    if (quantum < 1) {
+        fprintf(stderr, "Stride: quantum inválido (%d)\n", quantum);
+        return;
+    }
+
+    int *arrivals = build_arrival_order(table, 1, &num_arrivals);
+    long long *pass = malloc((n > 0 ? n : 1) * sizeof(long long));
+    long long *seq = malloc((n > 0 ? n : 1) * sizeof(long long));
+    long long *stride = malloc((n > 0 ? n : 1) * sizeof(long long));
+    stride_keys_t keys = {pass, seq};
+    int allocated = arrivals && pass && seq && stride;
+    if (!allocated) perror("Fallo en la asignación de memoria para stride");
+    if (!allocated || ready_queue_init(&ready, num_arrivals, compare_pass, &keys) != 0) {
+        free(arrivals);
+        free(pass);
+        free(seq);
+        free(stride);
+        return;
+    }
+
+    while ((next < num_arrivals || ready.size > 0 || preempted != -1) &&
+           !simulation_cancelled(timeline, current_time)) {
+        // 1. Admitir las llegadas hasta el instante actual
+        while (next < num_arrivals && table->arrival[arrivals[next]] <= current_time) {
+            int idx = arrivals[next++];
+            stride[idx] = STRIDE_ONE / nice_weight(table->priority[idx]);
+            pass[idx] = min_pass + stride[idx];
+            seq[idx] = next_seq++;
+            ready_queue_push(&ready, idx);
+        }
+
+        // 2. El proceso desalojado vuelve con su nuevo pass, detrás de las llegadas
+        if (preempted != -1) {
+            seq[preempted] = next_seq++;
+            ready_queue_push(&ready, preempted);
+            preempted = -1;
+        }
+
+        // 3. Sin procesos listos: saltar a la siguiente llegada (IDLE)
+        if (ready.size == 0) {
+            int next_arrival = table->arrival[arrivals[next]];
+            timeline_append(timeline, current_time, -1, next_arrival - current_time); // IDLE
+            current_time = next_arrival;
+            current_idx = -1;
+            continue;
+        }
+
+        // 4. Despachar el proceso con menor pass
+        int idx = ready_queue_pop(&ready);
+        if (idx != current_idx) {
+            timeline_append(timeline, current_time, table->pid[idx], 0);
+
+            if (table->start[idx] == -1) {
+                table->start[idx] = current_time;
+            }
+        }
+        current_idx = idx;
+        if (pass[idx] > min_pass) min_pass = pass[idx]; // El menor pass de los listos
+
+        // 5. Ejecutar un quantum (o lo que le quede) y avanzar su pass
+        int run = table->remaining[idx] < quantum ? table->remaining[idx] : quantum;
+        table->remaining[idx] -= run;
+        timeline->events[timeline->count - 1].duration += run;
+        current_time += run;
+        pass[idx] += stride[idx] * run;
+
+        // 6. Finalización, o reinserción tras admitir las llegadas del quantum
+        if (table->remaining[idx] == 0) {
+            complete_process(table, idx, current_time, timeline);
+        } else {
+            preempted = idx;
+        }
+    }
+
+    // 7. Finalizar la línea de tiempo
+    timeline_append(timeline, current_time, 0, 0);
+
+    ready_queue_free(&ready);
+    free(stride);
+    free(seq);
+    free(pass);
+    free(arrivals);
+}
+
+void schedule_stride(process_t *processes, int n, int quantum, timeline_t *timeline) {
+    proc_table_t table;
+    if (proc_table_load(&table, processes, n) != 0) {
+        timeline_clear(timeline);
+        return;
+    }
+    schedule_stride_table(&table, quantum, timeline);
+    proc_table_store(&table, processes);
+    proc_table_free(&table);
+}
+
+// --- Algoritmo 8: Lottery Scheduling ---
+
+/**
+ * @brief Generador pseudoaleatorio xorshift64*: estado local, así el planificador
+ * es reentrante y reproducible a partir de la semilla.
+ */
+static unsigned long long lottery_next(unsigned long long *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ULL;
+}
+
+/**
+ * @brief Lottery scheduling por despachos.
+ * Los tickets de los procesos listos viven en un árbol de Fenwick (ticket_tree_t):
+ * cada quantum se sortea un ticket en [0, tickets totales) y se ejecuta a su dueño.
+ * Sortear, retirar los tickets de un proceso terminado y añadir los de una llegada
+ * cuestan O(log n), sin recorrer los procesos.
+ */
+void schedule_lottery_table(proc_table_t *table, int quantum, unsigned int seed, timeline_t *timeline) {
+    int n = table->n;
+    int current_time = 0;
+    int num_arrivals = 0;
+    int next = 0;
+    int current_idx = -1;
+    unsigned long long rng = 0x9E3779B97F4A7C15ULL ^ seed; // Nunca 0 (xorshift quedaría fijo)
+    ticket_tree_t tickets;
+
+    timeline_clear(timeline);
+    if (quantum < 1) {
+        fprintf(stderr, "Lotería: quantum inválido (%d)\n", quantum);
+        return;
+    }
+
+    int *arrivals = build_arrival_order(table, 1, &num_arrivals);
+    if (!arrivals || ticket_tree_init(&tickets, n) != 0) {
+        free(arrivals);
+        return;
+    }
+
+    while ((next < num_arrivals || tickets.total > 0) && !simulation_cancelled(timeline, current_time)) {
+        // 1. Las llegadas hasta el instante actual entran al sorteo
+        while (next < num_arrivals && table->arrival[arrivals[next]] <= current_time) {
+            int idx = arrivals[next++];
+            ticket_tree_add(&tickets, idx, nice_weight(table->priority[idx]));
+        }
+
+        // 2. Sin procesos listos: saltar a la siguiente llegada (IDLE)
+        if (tickets.total == 0) {
+            int next_arrival = table->arrival[arrivals[next]];
+            timeline_append(timeline, current_time, -1, next_arrival - current_time); // IDLE
+            current_time = next_arrival;
+            current_idx = -1;
+            continue;
+        }
+
+        // 3. Sortear el ganador
+        int idx = ticket_tree_find(&tickets, (long long)(lottery_next(&rng) % (unsigned long long)tickets.total));
+        if (idx != current_idx) {
+            timeline_append(timeline, current_time, table->pid[idx], 0);
+
+            if (table->start[idx] == -1) {
+                table->start[idx] = current_time;
+            }
+        }
+        current_idx = idx;
+
+        // 4. Ejecutar un quantum (o lo que le quede)
+        int run = table->remaining[idx] < quantum ? table->remaining[idx] : quantum;
+        table->remaining[idx] -= run;
+        timeline->events[timeline->count - 1].duration += run;
+        current_time += run;
+
+        // 5. Al terminar, sus tickets salen del sorteo
+        if (table->remaining[idx] == 0) {
+            complete_process(table, idx, current_time, timeline);
+            ticket_tree_add(&tickets, idx, -nice_weight(table->priority[idx]));
+        }
+    }
+
+    // 6. Finalizar la línea de tiempo
+    timeline_append(timeline, current_time, 0, 0);
+
+    ticket_tree_free(&tickets);
+    free(arrivals);
+}
+
+void schedule_lottery(process_t *processes, int n, int quantum, unsigned int seed, timeline_t *timeline) {
+    proc_table_t table;
+    if (proc_table_load(&table, processes, n) != 0) {
+        timeline_clear(timeline);
+        return;
+    }
+    schedule_lottery_table(&table, quantum, seed, timeline);
+    proc_table_store(&table, processes);
+    proc_table_free(&table);
+}
+
+// --- Algoritmo 9: EDF (Earliest Deadline First) ---
+
+#define EDF_NO_DEADLINE 9223372036854775807LL // Clave de los procesos sin deadline: van al final
+
+/**
+ * @brief Contexto de la cola de EDF: deadlines absolutos y la tabla de procesos.
+ */
+typedef struct {
+    const long long *deadline;
+    const proc_table_t *table;
+} edf_keys_t;
+
+/**
+ * @brief Criterio de orden de EDF: menor deadline absoluto, luego menor
+ * arrival_time y, por último, menor índice. Los procesos sin deadline quedan
+ * detrás de todos los demás, en orden de llegada.
+ */
+static int compare_deadline(const void *ctx, int a, int b) {
+    const edf_keys_t *keys = ctx;
+
+    if (keys->deadline[a] != keys->deadline[b]) {
+        return keys->deadline[a] < keys->deadline[b] ? -1 : 1;
+    }
+    if (keys->table->arrival[a] != keys->table->arrival[b]) {
+        return keys->table->arrival[a] < keys->table->arrival[b] ? -1 : 1;
+    }
+    return a - b;
+}
+
+/**
+ * @brief EDF por eventos discretos.
+ * Mismo motor que schedule_stcf con otra clave: el deadline absoluto
+ * (arrival + deadline) no cambia mientras el proceso se ejecuta, así que entre
+ * dos eventos la decisión no cambia y el proceso en ejecución permanece en la
+ * raíz del heap. Una llegada con un deadline anterior lo desaloja.
+ */
+void schedule_edf_table(proc_table_t *table, timeline_t *timeline) {
+    int n = table->n;
+    int current_time = 0;
+    int num_arrivals = 0;
+    int next = 0;
+    int current_idx = -1;
+    ready_queue_t ready;
+
+    timeline_clear(timeline);
+
+    int *arrivals = build_arrival_order(table, 1, &num_arrivals);
+    long long *deadline = malloc((n > 0 ? n : 1) * sizeof(long long));
+    edf_keys_t keys = {deadline, table};
+    int allocated = arrivals && deadline;
+    if (!allocated) perror("Fallo en la asignación de memoria para EDF");
+    if (!allocated || ready_queue_init(&ready, num_arrivals, compare_deadline, &keys) != 0) {
+        free(arrivals);
+        free(deadline);
+        return;
+    }
+    for (int i = 0; i < n; i++) {
+        deadline[i] = table->deadline[i] > 0 ? (long long)table->arrival[i] + table->deadline[i] : EDF_NO_DEADLINE;
+    }
+
+    while ((next < num_arrivals || ready.size > 0) && !simulation_cancelled(timeline, current_time)) {
+        // 1. Admitir las llegadas hasta el instante actual
+        while (next < num_arrivals && table->arrival[arrivals[next]] <= current_time) {
+            ready_queue_push(&ready, arrivals[next++]);
+        }
+        int next_arrival = next < num_arrivals ? table->arrival[arrivals[next]] : -1;
+
+        // 2. Sin procesos elegibles: saltar a la siguiente llegada (IDLE)
+        if (ready.size == 0) {
+            timeline_append(timeline, current_time, -1, next_arrival - current_time); // IDLE
+            current_time = next_arrival;
+            continue;
+        }
+
+        // 3. Preempción / Inicio de un nuevo segmento (deadline más cercano)
+        int idx = ready_queue_peek(&ready);
+        if (idx != current_idx) {
+            timeline_append(timeline, current_time, table->pid[idx], 0);
+
+            if (table->start[idx] == -1) {
+                table->start[idx] = current_time;
+            }
+        }
+        current_idx = idx;
+
+        // 4. Ejecutar hasta la siguiente llegada o hasta terminar
+        int run = table->remaining[idx];
+        if (next_arrival != -1 && next_arrival - current_time < run) {
+            run = next_arrival - current_time;
+        }
+        table->remaining[idx] -= run;
+        timeline->events[timeline->count - 1].duration += run;
+        current_time += run;
+
+        // 5. Manejar la finalización del proceso
+        if (table->remaining[idx] == 0) {
+            complete_process(table, idx, current_time, timeline);
+            ready_queue_pop(&ready);
+            current_idx = -1;
+        }
+    }
+
+    // 6. Finalizar la línea de tiempo
+    timeline_append(timeline, current_time, 0, 0);
+
+    ready_queue_free(&ready);
+    free(deadline);
+    free(arrivals);
+}
+
+void schedule_edf(process_t *processes, int n, timeline_t *timeline) {
+    proc_table_t table;
+    if (proc_table_load(&table, processes, n) != 0) {
+        timeline_clear(timeline);
+        return;
+    }
+    schedule_edf_table(&table, timeline);
+    proc_table_store(&table, processes);
+    proc_table_free(&table);
+}
+
+// --- Algoritmo 10: Prioridades con Aging ---
+
+/**
+ * @brief Contexto de la cola de prioridades: clave con aging y la tabla de procesos.
+ */
+typedef struct {
+    const long long *key;
+    const proc_table_t *table;
+} priority_keys_t;
+
+/**
+ * @brief Criterio de orden de la cola de prioridades: menor clave, luego menor
+ * arrival_time y, por último, menor índice.
+ */
+static int compare_priority_key(const void *ctx, int a, int b) {
+    const priority_keys_t *keys = ctx;
+
+    if (keys->key[a] != keys->key[b]) {
+        return keys->key[a] < keys->key[b] ? -1 : 1;
+    }
+    if (keys->table->arrival[a] != keys->table->arrival[b]) {
+        return keys->table->arrival[a] < keys->table->arrival[b] ? -1 : 1;
+    }
+    return a - b;
+}
+
+/**
+ * @brief Nivel de prioridad efectivo en el instante time de un proceso en espera:
+ * priority - floor((time - ready_since) / aging_interval), o priority sin aging.
+ * ready_since se recupera de la clave (ver schedule_priority).
+ */
+static long long waiting_level(const proc_table_t *table, const long long *key, int idx,
+                               long long scale, int aging, int time) {
+    if (!aging) return table->priority[idx];
+    long long ready_since = key[idx] - table->priority[idx] * scale;
+    return table->priority[idx] - (time - ready_since) / scale;
+}
+
+/**
+ * @brief Planificación por prioridades por eventos, con aging por niveles enteros.
+ * Un proceso que espera desde ready_since tiene en el instante t el nivel
+ * priority - floor((t - ready_since) / aging_interval): mejora un nivel por cada
+ * aging_interval unidades completas de espera.
+ * La cola de listos ordena por clave = priority * aging_interval + ready_since,
+ * que es (priority - (t - ready_since) / aging_interval) * aging_interval + t: el
+ * nivel continuo escalado más t, común a todos. Su orden no cambia con t y refina
+ * el de los niveles enteros (el nivel entero es el techo del continuo), así que
+ * basta un min-heap con claves fijas: a igual nivel entero gana el de menor clave.
+ * El aging no recorre los procesos en espera: cuesta O(log n) por despacho, como STCF.
+ * El proceso en ejecución conserva el nivel entero con el que se despachó; solo lo
+ * desaloja uno en espera con nivel estrictamente mejor, de modo que dos procesos
+ * de igual prioridad no se alternan antes de aging_interval unidades de espera.
+ * Si lo desalojan, vuelve a esperar desde cero con su prioridad base.
+ * En modo preemptivo el reloj salta al siguiente evento: llegada, finalización o
+ * el instante en que el primero de la cola alcanza un nivel mejor que el actual.
+ */
+void schedule_priority_table(proc_table_t *table, priority_config_t *config, timeline_t *timeline) {
+    int n = table->n;
+    int current_time = 0;
+    int num_arrivals = 0;
+    int next = 0;
+    int current_idx = -1;       // Último proceso con segmento abierto en la línea de tiempo
+    int running = -1;           // Proceso en la CPU (-1 = ninguno)
+    long long running_level = 0; // Nivel efectivo (entero) con el que se despachó
+    ready_queue_t ready;
+
+    timeline_clear(timeline);
+    if (config->aging_interval < 0) {
+        fprintf(stderr, "Prioridades: aging_interval inválido (%d)\n", config->aging_interval);
+        return;
+    }
+
+    int aging = config->aging_interval > 0;
+    long long scale = aging ? config->aging_interval : 1;
+
+    int *arrivals = build_arrival_order(table, 1, &num_arrivals);
+    long long *key = malloc((n > 0 ? n : 1) * sizeof(long long));
+    priority_keys_t keys = {key, table};
+    int allocated = arrivals && key;
+    if (!allocated) perror("Fallo en la asignación de memoria para la planificación por prioridades");
+    if (!allocated || ready_queue_init(&ready, num_arrivals, compare_priority_key, &keys) != 0) {
+        free(arrivals);
+        free(key);
+        return;
+    }
+
+    while ((next < num_arrivals || ready.size > 0 || running != -1) &&
+           !simulation_cancelled(timeline, current_time)) {
+        // 1. Admitir las llegadas hasta el instante actual (esperan desde su llegada)
+        while (next < num_arrivals && table->arrival[arrivals[next]] <= current_time) {
+            int idx = arrivals[next++];
+            key[idx] = table->priority[idx] * scale + (aging ? table->arrival[idx] : 0);
+            ready_queue_push(&ready, idx);
+        }
+        int next_arrival = next < num_arrivals ? table->arrival[arrivals[next]] : -1;
+
+        // 2. Preempción: el primero de la cola supera la prioridad efectiva del actual
+        if (config->preemptive && running != -1 && ready.size > 0) {
+            int top = ready_queue_peek(&ready);
+            if (waiting_level(table, key, top, scale, aging, current_time) < running_level) {
+                // Vuelve a esperar desde ahora, con su prioridad base
+                key[running] = table->priority[running] * scale + (aging ? current_time : 0);
+                ready_queue_push(&ready, running);
+                running = -1;
+            }
+        }
+
+        // 3. CPU libre: despachar el de mejor prioridad efectiva o saltar a la siguiente llegada (IDLE)
+        if (running == -1) {
+            if (ready.size == 0) {
+                timeline_append(timeline, current_time, -1, next_arrival - current_time); // IDLE
+                current_time = next_arrival;
+                current_idx = -1;
+                continue;
+            }
+            running = ready_queue_pop(&ready);
+            running_level = waiting_level(table, key, running, scale, aging, current_time);
+            if (running != current_idx) {
+                timeline_append(timeline, current_time, table->pid[running], 0);
+
+                if (table->start[running] == -1) {
+                    table->start[running] = current_time;
+                }
+            }
+            current_idx = running;
+        }
+
+        // 4. Ejecutar hasta terminar o, si es preemptivo, hasta el siguiente evento
+        long long run = table->remaining[running];
+        if (config->preemptive) {
+            if (next_arrival != -1 && next_arrival - current_time < run) {
+                run = next_arrival - current_time;
+            }
+            if (aging && ready.size > 0) {
+                // Primer instante t con waiting_level(top, t) < running_level:
+                // ready_since + (priority - running_level + 1) * aging_interval
+                int top = ready_queue_peek(&ready);
+                long long ready_since = key[top] - table->priority[top] * scale;
+                long long overtake = ready_since + (table->priority[top] - running_level + 1) * scale;
+                if (overtake - current_time < run) run = overtake - current_time;
+            }
+        }
+        table->remaining[running] -= (int)run;
+        timeline->events[timeline->count - 1].duration += (int)run;
+        current_time += (int)run;
+
+        // 5. Manejar la finalización del proceso
+        if (table->remaining[running] == 0) {
+            complete_process(table, running, current_time, timeline);
+            running = -1;
+        }
+    }
+
+    // 6. Finalizar la línea de tiempo
+    timeline_append(timeline, current_time, 0, 0);
+
+    ready_queue_free(&ready);
+    free(key);
+    free(arrivals);
+}
+
+void schedule_priority(process_t *processes, int n, priority_config_t *config, timeline_t *timeline) {
+    proc_table_t table;
+    if (proc_table_load(&table, processes, n) != 0) {
+        timeline_clear(timeline);
+        return;
+    }
+    schedule_priority_table(&table, config, timeline);
+    proc_table_store(&table, processes);
+    proc_table_free(&table);
 }
 
 // --- Algoritmo 4: Round Robin (RR) ---
 
-void schedule_rr(process_t *processes, int n, int quantum, timeline_event_t *timeline) {
-    // Pista: Implementar una cola circular (o un array/lista simple) para la Ready Queue.
-    // Usar el campo remaining_time y preempción cuando el proceso usa el 'quantum' completo.
-    
-    printf("Round Robin no implementado. Se requiere gestionar una cola Ready y el quantum.\n");
-    // Implementación requerida...
+/**
+ * @brief Round Robin por despachos.
+ * La cola de listos es una cola circular de capacidad fija (un lugar por proceso),
+ * reservada una vez al inicio. Cada iteración despacha un proceso y avanza el reloj
+ * un quantum completo (o lo que le quede de burst) de una sola vez.
+ * Las llegadas ocurridas durante el quantum, incluida la del instante en que termina,
+ * entran a la cola antes que el proceso desalojado.
+ * Si el proceso está solo en la cola, ejecuta todos los quantums completos hasta el
+ * primero que contenga la siguiente llegada: nadie podría desalojarlo antes.
+ * Así el costo es O(despachos), independiente de la longitud de los bursts.
+ */
+void schedule_rr_table(proc_table_t *table, int quantum, timeline_t *timeline) {
+    int current_time = 0;
+    int num_arrivals = 0;
+    int next = 0;
+    int current_idx = -1;
+    ring_queue_t ready;
+
+    timeline_clear(timeline);
+    if (quantum < 1) {
+        fprintf(stderr, "Round Robin: quantum inválido (%d)\n", quantum);
+        return;
+    }
+
+    int *arrivals = build_arrival_order(table, 1, &num_arrivals);
+    if (!arrivals || ring_queue_init(&ready, num_arrivals) != 0) {
+        free(arrivals);
+        return;
+    }
+
+    while ((next < num_arrivals || ready.size > 0) && !simulation_cancelled(timeline, current_time)) {
+        // 1. Admitir las llegadas hasta el instante actual
+        while (next < num_arrivals && table->arrival[arrivals[next]] <= current_time) {
+            ring_queue_push(&ready, arrivals[next++]);
+        }
+
+        // 2. Sin procesos listos: saltar a la siguiente llegada (IDLE)
+        if (ready.size == 0) {
+            int next_arrival = table->arrival[arrivals[next]];
+            timeline_append(timeline, current_time, -1, next_arrival - current_time); // IDLE
+            current_time = next_arrival;
+            current_idx = -1;
+            continue;
+        }
+
+        // 3. Despachar el primer proceso de la cola
+        int idx = ring_queue_pop(&ready);
+        if (idx != current_idx) {
+            timeline_append(timeline, current_time, table->pid[idx], 0);
+
+            if (table->start[idx] == -1) {
+                table->start[idx] = current_time;
+            }
+        }
+        current_idx = idx;
+
+        // 4. Calcular cuánto ejecuta: un quantum, o varios si está solo
+        long long run = table->remaining[idx] < quantum ? table->remaining[idx] : quantum;
+        if (ready.size == 0 && table->remaining[idx] > quantum) {
+            long long until = table->remaining[idx];
+            if (next < num_arrivals) {
+                // Quantums completos hasta cubrir la siguiente llegada (que es > current_time)
+                long long gap = table->arrival[arrivals[next]] - current_time;
+                long long slices = (gap + quantum - 1) / quantum;
+                if (slices * quantum < until) until = slices * quantum;
+            }
+            run = until;
+        }
+        table->remaining[idx] -= (int)run;
+        timeline->events[timeline->count - 1].duration += (int)run;
+        current_time += (int)run;
+
+        // 5. Las llegadas durante el quantum van antes que el proceso desalojado
+        while (next < num_arrivals && table->arrival[arrivals[next]] <= current_time) {
+            ring_queue_push(&ready, arrivals[next++]);
+        }
+
+        // 6. Finalización o regreso al final de la cola
+        if (table->remaining[idx] == 0) {
+            complete_process(table, idx, current_time, timeline);
+        } else {
+            ring_queue_push(&ready, idx);
+        }
+    }
+
+    // 7. Finalizar la línea de tiempo
+    timeline_append(timeline, current_time, 0, 0);
+
+    ring_queue_free(&ready);
+    free(arrivals);
+}
+
+void schedule_rr(process_t *processes, int n, int quantum, timeline_t *timeline) {
+    proc_table_t table;
+    if (proc_table_load(&table, processes, n) != 0) {
+        timeline_clear(timeline);
+        return;
+    }
+    schedule_rr_table(&table, quantum, timeline);
+    proc_table_store(&table, processes);
+    proc_table_free(&table);
 }
 
 // --- Algoritmo 5: MLFQ (Multi-Level Feedback Queue) ---
 
-void schedule_mlfq(process_t *processes, int n, mlfq_config_t *config, timeline_event_t *timeline) {
-    // Pista: Requiere múltiples colas (ej: una lista de listas), la lógica de 
-    // degradación (al usar el quantum completo) y el boost periódico (cada boost_interval).
-    
-    printf("MLFQ no implementado. Se requiere múltiples colas, lógica de boost y degradación.\n");
-    // Implementación requerida...
+/**
+ * @brief MLFQ por eventos.
+ * Reglas:
+ * - Un proceso nuevo entra al final de Q0 y desaloja al proceso en ejecución.
+ * - Al agotar el quantum de su cola, el proceso baja un nivel (el último nivel
+ *   funciona como Round Robin). Si lo desaloja una llegada o un boost, vuelve al
+ *   final de su cola conservando el tiempo usado de su quantum.
+ * - Cada boost_interval (0 = sin boost) todos los procesos vuelven a Q0.
+ * Las colas por nivel son un level_queue_t (ver ready_queue.h).
+ * El boost es perezoso: las listas se concatenan en O(niveles) y cada proceso
+ * recupera nivel 0 y quantum nuevo al despacharse, comparando su época con la
+ * época global. El reloj salta de evento en evento (fin de quantum, llegada,
+ * boost o finalización), así que el costo no depende de los bursts.
+ */
+void schedule_mlfq_table(proc_table_t *table, mlfq_config_t *config, timeline_t *timeline) {
+    int n = table->n;
+    int current_time = 0;
+    int num_arrivals = 0;
+    int next = 0;
+    int current_idx = -1;
+    int epoch = 0;
+    level_queue_t queues;
+
+    timeline_clear(timeline);
+    if (config->num_queues < 1 || config->num_queues > MAX_QUEUES) {
+        fprintf(stderr, "MLFQ: número de colas inválido (%d, máximo %d)\n", config->num_queues, MAX_QUEUES);
+        return;
+    }
+    for (int level = 0; level < config->num_queues; level++) {
+        if (config->quantums[level] < 1) {
+            fprintf(stderr, "MLFQ: quantum inválido en Q%d (%d)\n", level, config->quantums[level]);
+            return;
+        }
+    }
+
+    int last_level = config->num_queues - 1;
+    int boost_interval = config->boost_interval;
+    long long next_boost = boost_interval > 0 ? boost_interval : -1;
+
+    int *arrivals = build_arrival_order(table, 1, &num_arrivals);
+    int *queue_next = malloc((n > 0 ? n : 1) * sizeof(int));
+    int *proc_epoch = malloc((n > 0 ? n : 1) * sizeof(int));
+    if (!arrivals || !queue_next || !proc_epoch) {
+        perror("Fallo en la asignación de memoria para las colas MLFQ");
+        free(arrivals);
+        free(queue_next);
+        free(proc_epoch);
+        return;
+    }
+    level_queue_init(&queues, queue_next);
+
+    while ((next < num_arrivals || queues.bitmap) && !simulation_cancelled(timeline, current_time)) {
+        // 1. Priority Boost pendiente
+        if (next_boost != -1 && current_time >= next_boost) {
+            level_queue_boost(&queues);
+            epoch++; // Los procesos encolados recuperan Q0 y quantum al despacharse
+            next_boost = ((long long)current_time / boost_interval + 1) * boost_interval;
+        }
+
+        // 2. Admitir las llegadas hasta el instante actual (al final de Q0)
+        while (next < num_arrivals && table->arrival[arrivals[next]] <= current_time) {
+            int idx = arrivals[next++];
+            table->queue_level[idx] = 0;
+            table->quantum_used[idx] = 0;
+            proc_epoch[idx] = epoch;
+            level_queue_push(&queues, 0, idx);
+        }
+
+        // 3. Sin procesos listos: saltar a la siguiente llegada (IDLE)
+        if (!queues.bitmap) {
+            int next_arrival = table->arrival[arrivals[next]];
+            timeline_append(timeline, current_time, -1, next_arrival - current_time); // IDLE
+            current_time = next_arrival;
+            current_idx = -1;
+            if (next_boost != -1 && current_time >= next_boost) {
+                // Boosts durante el tiempo ocioso: no hay procesos que mover
+                epoch++;
+                next_boost = ((long long)current_time / boost_interval + 1) * boost_interval;
+            }
+            continue;
+        }
+
+        // 4. Despachar la cola de mayor prioridad no vacía (find-first-set)
+        int idx = level_queue_pop(&queues);
+        if (proc_epoch[idx] != epoch) {
+            // Boost perezoso: hubo un boost desde la última vez que se encoló
+            proc_epoch[idx] = epoch;
+            table->queue_level[idx] = 0;
+            table->quantum_used[idx] = 0;
+        }
+        int level = table->queue_level[idx];
+
+        if (idx != current_idx) {
+            timeline_append(timeline, current_time, table->pid[idx], 0);
+
+            if (table->start[idx] == -1) {
+                table->start[idx] = current_time;
+            }
+        }
+        current_idx = idx;
+
+        // 5. Ejecutar hasta el siguiente evento: fin de quantum, llegada, boost o finalización
+        int quantum = config->quantums[level];
+        long long run = table->remaining[idx];
+        int alone_in_last = !queues.bitmap && level == last_level;
+        if (!alone_in_last && quantum - table->quantum_used[idx] < run) {
+            run = quantum - table->quantum_used[idx];
+        }
+        if (next < num_arrivals && table->arrival[arrivals[next]] - current_time < run) {
+            run = table->arrival[arrivals[next]] - current_time;
+        }
+        if (next_boost != -1 && next_boost - current_time < run) {
+            run = next_boost - current_time;
+        }
+        table->remaining[idx] -= (int)run;
+        timeline->events[timeline->count - 1].duration += (int)run;
+        current_time += (int)run;
+
+        // 6. Las llegadas ocurridas entran a Q0 antes que el proceso desalojado
+        while (next < num_arrivals && table->arrival[arrivals[next]] <= current_time) {
+            int arrived = arrivals[next++];
+            table->queue_level[arrived] = 0;
+            table->quantum_used[arrived] = 0;
+            proc_epoch[arrived] = epoch;
+            level_queue_push(&queues, 0, arrived);
+        }
+
+        // 7. Finalización, degradación o regreso a su cola
+        if (table->remaining[idx] == 0) {
+            complete_process(table, idx, current_time, timeline);
+            current_idx = -1;
+        } else if (alone_in_last) {
+            // Solo en el último nivel: los quantums completos no cambian nada
+            table->quantum_used[idx] = (int)((table->quantum_used[idx] + run) % quantum);
+            level_queue_push(&queues, level, idx);
+        } else if (table->quantum_used[idx] + run >= quantum) {
+            table->quantum_used[idx] = 0;
+            table->queue_level[idx] = level < last_level ? level + 1 : last_level;
+            level_queue_push(&queues, table->queue_level[idx], idx);
+        } else {
+            table->quantum_used[idx] += (int)run;
+            level_queue_push(&queues, level, idx);
+        }
+    }
+
+    // 8. Finalizar la línea de tiempo
+    timeline_append(timeline, current_time, 0, 0);
+
+    free(proc_epoch);
+    free(queue_next);
+    free(arrivals);
+}
+
+void schedule_mlfq(process_t *processes, int n, mlfq_config_t *config, timeline_t *timeline) {
+    proc_table_t table;
+    if (proc_table_load(&table, processes, n) != 0) {
+        timeline_clear(timeline);
+        return;
+    }
+    schedule_mlfq_table(&table, config, timeline);
+    proc_table_store(&table, processes);
+    proc_table_free(&table);
 }
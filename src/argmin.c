@@ -0,0 +1,207 @@
+#include <limits.h>
+#include "../include/argmin.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+// --- Implementación Escalar ---
+
+int eligible_argmin_scalar(const int *arrival, const int *remaining, int n, int current_time) {
+    int shortest = -1;
+    int min_remaining = INT_MAX;
+
+    for (int i = 0; i < n; i++) {
+        if (arrival[i] <= current_time && remaining[i] > 0) {
+            if (remaining[i] < min_remaining) {
+                min_remaining = remaining[i];
+                shortest = i;
+            } else if (remaining[i] == min_remaining && arrival[i] < arrival[shortest]) {
+                shortest = i;
+            }
+        }
+    }
+    return shortest;
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+
+// Las versiones vectoriales hacen tres recorridos sobre las columnas calientes:
+//   1. mínimo remaining entre los elegibles,
+//   2. mínimo arrival entre los elegibles con ese remaining,
+//   3. primer índice elegible con ese par (remaining, arrival).
+// Si el mínimo es INT_MAX (sin elegibles, o remaining == INT_MAX) se delega en la
+// versión escalar, que resuelve el caso límite con exactitud.
+
+// --- Implementación SSE4.1 (4 carriles) ---
+
+__attribute__((target("sse4.1")))
+static inline __m128i eligible_mask_sse41(__m128i a, __m128i r, __m128i now, __m128i zero) {
+    return _mm_andnot_si128(_mm_cmpgt_epi32(a, now), _mm_cmpgt_epi32(r, zero));
+}
+
+__attribute__((target("sse4.1")))
+static inline int hmin_sse41(__m128i v) {
+    v = _mm_min_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+    v = _mm_min_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(v);
+}
+
+__attribute__((target("sse4.1")))
+int eligible_argmin_sse41(const int *arrival, const int *remaining, int n, int current_time) {
+    const __m128i now = _mm_set1_epi32(current_time);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i max = _mm_set1_epi32(INT_MAX);
+    int blocks = n & ~3;
+    int i;
+
+    // 1. Mínimo remaining entre los elegibles
+    __m128i vmin = max;
+    for (i = 0; i < blocks; i += 4) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(arrival + i));
+        __m128i r = _mm_loadu_si128((const __m128i *)(remaining + i));
+        __m128i mask = eligible_mask_sse41(a, r, now, zero);
+        vmin = _mm_min_epi32(vmin, _mm_blendv_epi8(max, r, mask));
+    }
+    int min_remaining = hmin_sse41(vmin);
+    for (; i < n; i++) {
+        if (arrival[i] <= current_time && remaining[i] > 0 && remaining[i] < min_remaining) {
+            min_remaining = remaining[i];
+        }
+    }
+    if (min_remaining == INT_MAX) {
+        return eligible_argmin_scalar(arrival, remaining, n, current_time);
+    }
+
+    // 2. Mínimo arrival entre los elegibles con remaining == min_remaining
+    // (remaining == min_remaining > 0 ya implica remaining > 0)
+    const __m128i target_r = _mm_set1_epi32(min_remaining);
+    __m128i amin = max;
+    for (i = 0; i < blocks; i += 4) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(arrival + i));
+        __m128i r = _mm_loadu_si128((const __m128i *)(remaining + i));
+        __m128i mask = _mm_andnot_si128(_mm_cmpgt_epi32(a, now), _mm_cmpeq_epi32(r, target_r));
+        amin = _mm_min_epi32(amin, _mm_blendv_epi8(max, a, mask));
+    }
+    int min_arrival = hmin_sse41(amin);
+    for (; i < n; i++) {
+        if (remaining[i] == min_remaining && arrival[i] <= current_time && arrival[i] < min_arrival) {
+            min_arrival = arrival[i];
+        }
+    }
+
+    // 3. Primer índice con (remaining, arrival) == (min_remaining, min_arrival)
+    const __m128i target_a = _mm_set1_epi32(min_arrival);
+    for (i = 0; i < blocks; i += 4) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(arrival + i));
+        __m128i r = _mm_loadu_si128((const __m128i *)(remaining + i));
+        int bits = _mm_movemask_ps(_mm_castsi128_ps(_mm_and_si128(_mm_cmpeq_epi32(a, target_a),
+                                                                   _mm_cmpeq_epi32(r, target_r))));
+        if (bits) return i + __builtin_ctz(bits);
+    }
+    for (; i < n; i++) {
+        if (remaining[i] == min_remaining && arrival[i] == min_arrival) return i;
+    }
+    return -1; // Inalcanzable: el par mínimo existe
+}
+
+// --- Implementación AVX2 (8 carriles) ---
+
+__attribute__((target("avx2")))
+static inline int hmin_avx2(__m256i v) {
+    __m128i m = _mm_min_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    m = _mm_min_epi32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(1, 0, 3, 2)));
+    m = _mm_min_epi32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(m);
+}
+
+__attribute__((target("avx2")))
+int eligible_argmin_avx2(const int *arrival, const int *remaining, int n, int current_time) {
+    const __m256i now = _mm256_set1_epi32(current_time);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i max = _mm256_set1_epi32(INT_MAX);
+    int blocks = n & ~7;
+    int i;
+
+    // 1. Mínimo remaining entre los elegibles
+    __m256i vmin = max;
+    for (i = 0; i < blocks; i += 8) {
+        __m256i a = _mm256_loadu_si256((const __m256i *)(arrival + i));
+        __m256i r = _mm256_loadu_si256((const __m256i *)(remaining + i));
+        __m256i mask = _mm256_andnot_si256(_mm256_cmpgt_epi32(a, now), _mm256_cmpgt_epi32(r, zero));
+        vmin = _mm256_min_epi32(vmin, _mm256_blendv_epi8(max, r, mask));
+    }
+    int min_remaining = hmin_avx2(vmin);
+    for (; i < n; i++) {
+        if (arrival[i] <= current_time && remaining[i] > 0 && remaining[i] < min_remaining) {
+            min_remaining = remaining[i];
+        }
+    }
+    if (min_remaining == INT_MAX) {
+        return eligible_argmin_scalar(arrival, remaining, n, current_time);
+    }
+
+    // 2. Mínimo arrival entre los elegibles con remaining == min_remaining
+    // (remaining == min_remaining > 0 ya implica remaining > 0)
+    const __m256i target_r = _mm256_set1_epi32(min_remaining);
+    __m256i amin = max;
+    for (i = 0; i < blocks; i += 8) {
+        __m256i a = _mm256_loadu_si256((const __m256i *)(arrival + i));
+        __m256i r = _mm256_loadu_si256((const __m256i *)(remaining + i));
+        __m256i mask = _mm256_andnot_si256(_mm256_cmpgt_epi32(a, now), _mm256_cmpeq_epi32(r, target_r));
+        amin = _mm256_min_epi32(amin, _mm256_blendv_epi8(max, a, mask));
+    }
+    int min_arrival = hmin_avx2(amin);
+    for (; i < n; i++) {
+        if (remaining[i] == min_remaining && arrival[i] <= current_time && arrival[i] < min_arrival) {
+            min_arrival = arrival[i];
+        }
+    }
+
+    // 3. Primer índice con (remaining, arrival) == (min_remaining, min_arrival)
+    const __m256i target_a = _mm256_set1_epi32(min_arrival);
+    for (i = 0; i < blocks; i += 8) {
+        __m256i a = _mm256_loadu_si256((const __m256i *)(arrival + i));
+        __m256i r = _mm256_loadu_si256((const __m256i *)(remaining + i));
+        int bits = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_and_si256(_mm256_cmpeq_epi32(a, target_a),
+                                                                           _mm256_cmpeq_epi32(r, target_r))));
+        if (bits) return i + __builtin_ctz(bits);
+    }
+    for (; i < n; i++) {
+        if (remaining[i] == min_remaining && arrival[i] == min_arrival) return i;
+    }
+    return -1; // Inalcanzable: el par mínimo existe
+}
+
+#endif
+
+// --- Selección en Tiempo de Ejecución ---
+
+static eligible_argmin_fn selected_impl = eligible_argmin_scalar;
+static const char *selected_name = "scalar";
+
+/**
+ * @brief Elige la mejor implementación soportada por la CPU antes de main,
+ * de modo que el puntero ya no cambia cuando hay varios hilos simulando.
+ */
+__attribute__((constructor))
+static void select_eligible_argmin(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        selected_impl = eligible_argmin_avx2;
+        selected_name = "avx2";
+    } else if (__builtin_cpu_supports("sse4.1")) {
+        selected_impl = eligible_argmin_sse41;
+        selected_name = "sse4.1";
+    }
+#endif
+}
+
+int eligible_argmin(const int *arrival, const int *remaining, int n, int current_time) {
+    return selected_impl(arrival, remaining, n, current_time);
+}
+
+const char *eligible_argmin_name(void) {
+    return selected_name;
+}
@@ -0,0 +1,112 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "../include/buffers.h"
+#include "../include/metrics.h"
+
+#define INITIAL_CAPACITY 16
+
+/**
+ * @brief Calcula la nueva capacidad duplicando la actual hasta alcanzar needed.
+ */
+static int grow_capacity(int capacity, int needed) {
+    int new_capacity = capacity > 0 ? capacity : INITIAL_CAPACITY;
+    while (new_capacity < needed) {
+        new_capacity *= 2;
+    }
+    return new_capacity;
+}
+
+// --- Conjunto de Procesos ---
+
+void process_set_init(process_set_t *set) {
+    set->items = NULL;
+    set->count = 0;
+    set->capacity = 0;
+}
+
+void process_set_free(process_set_t *set) {
+    free(set->items);
+    process_set_init(set);
+}
+
+void process_set_reserve(process_set_t *set, int capacity) {
+    if (capacity <= set->capacity) return;
+
+    int new_capacity = grow_capacity(set->capacity, capacity);
+    process_t *items = realloc(set->items, (size_t)new_capacity * sizeof(process_t));
+    if (!items) {
+        perror("Fallo en la asignación de memoria para el conjunto de procesos");
+        exit(EXIT_FAILURE);
+    }
+    set->items = items;
+    set->capacity = new_capacity;
+}
+
+void process_set_append(process_set_t *set, const process_t *process) {
+    if (set->count == set->capacity) {
+        process_set_reserve(set, set->count + 1);
+    }
+    set->items[set->count++] = *process;
+}
+
+void process_set_reset(process_set_t *set, process_t *original, int n) {
+    process_set_reserve(set, n);
+    reset_processes(set->items, n, original);
+    set->count = n;
+}
+
+// --- Línea de Tiempo ---
+
+void timeline_init(timeline_t *timeline) {
+    timeline->events = NULL;
+    timeline->count = 0;
+    timeline->capacity = 0;
+    timeline->stats = NULL;
+    timeline->control = NULL;
+}
+
+void timeline_free(timeline_t *timeline) {
+    free(timeline->events);
+    timeline_init(timeline);
+}
+
+void timeline_clear(timeline_t *timeline) {
+    timeline->count = 0;
+    if (timeline->stats) metrics_acc_reset(timeline->stats);
+}
+
+void timeline_append(timeline_t *timeline, int time, int pid, int duration) {
+    if (timeline->count == timeline->capacity) {
+        int new_capacity = grow_capacity(timeline->capacity, timeline->count + 1);
+        timeline_event_t *events = realloc(timeline->events, (size_t)new_capacity * sizeof(timeline_event_t));
+        if (!events) {
+            perror("Fallo en la asignación de memoria para la línea de tiempo");
+            exit(EXIT_FAILURE);
+        }
+        timeline->events = events;
+        timeline->capacity = new_capacity;
+    }
+
+    timeline_event_t *event = &timeline->events[timeline->count++];
+    event->time = time;
+    event->pid = pid;
+    event->duration = duration;
+}
+
+// --- Estado de Simulación ---
+
+void reset_processes(process_t *processes, int n, process_t *original) {
+    for (int i = 0; i < n; i++) {
+        // Copiar todos los campos base
+        processes[i] = original[i];
+        // Inicializar campos de simulación/resultado
+        processes[i].remaining_time = processes[i].burst_time;
+        processes[i].start_time = -1; // Usar -1 para indicar que no ha comenzado
+        processes[i].completion_time = 0;
+        processes[i].turnaround_time = 0;
+        processes[i].waiting_time = 0;
+        processes[i].response_time = 0;
+        processes[i].current_queue = 0;
+        processes[i].time_in_current_quantum = 0;
+    }
+}
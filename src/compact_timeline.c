@@ -0,0 +1,152 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "../include/compact_timeline.h"
+
+#define INITIAL_CAPACITY 64
+#define MAX_SEGMENT_BYTES 20    // Cabecera (34 bits: 5 bytes) + hueco + duración, con margen
+
+// --- Varints ---
+
+static unsigned long long zigzag(int value) {
+    return ((unsigned int)value << 1) ^ (value < 0 ? 0xFFFFFFFFu : 0u);
+}
+
+static int unzigzag(unsigned long long value) {
+    return (int)(unsigned int)((value >> 1) ^ (0ULL - (value & 1)));
+}
+
+static void put_varint(compact_timeline_t *timeline, unsigned long long value) {
+    while (value >= 0x80) {
+        timeline->data[timeline->size++] = (unsigned char)(value | 0x80);
+        value >>= 7;
+    }
+    timeline->data[timeline->size++] = (unsigned char)value;
+}
+
+static unsigned long long get_varint(const unsigned char *data, size_t *pos) {
+    unsigned long long value = 0;
+    int shift = 0;
+    unsigned char byte;
+    do {
+        byte = data[(*pos)++];
+        value |= (unsigned long long)(byte & 0x7F) << shift;
+        shift += 7;
+    } while (byte & 0x80);
+    return value;
+}
+
+// --- Codificación ---
+
+/**
+ * @brief Codifica el segmento pendiente al final de los datos.
+ */
+static void flush_pending(compact_timeline_t *timeline) {
+    if (!timeline->has_pending) return;
+
+    if (timeline->capacity - timeline->size < MAX_SEGMENT_BYTES) {
+        size_t new_capacity = timeline->capacity > 0 ? timeline->capacity * 2 : INITIAL_CAPACITY;
+        unsigned char *data = realloc(timeline->data, new_capacity);
+        if (!data) {
+            perror("Fallo en la asignación de memoria para la línea de tiempo compacta");
+            exit(EXIT_FAILURE);
+        }
+        timeline->data = data;
+        timeline->capacity = new_capacity;
+    }
+
+    const timeline_event_t *event = &timeline->pending;
+    int gap = (int)((unsigned int)event->time - (unsigned int)timeline->prev_end);
+    int pid_delta = (int)((unsigned int)event->pid - (unsigned int)timeline->prev_pid);
+    int same_duration = event->duration == timeline->prev_duration;
+    put_varint(timeline, zigzag(pid_delta) << 2 | (unsigned long long)same_duration << 1 | (gap != 0));
+    if (gap != 0) put_varint(timeline, zigzag(gap));
+    if (!same_duration) put_varint(timeline, (unsigned int)event->duration);
+
+    timeline->prev_pid = event->pid;
+    timeline->prev_end = event->time + event->duration;
+    timeline->prev_duration = event->duration;
+    timeline->has_pending = 0;
+}
+
+void compact_timeline_init(compact_timeline_t *timeline) {
+    timeline->data = NULL;
+    timeline->capacity = 0;
+    compact_timeline_clear(timeline);
+}
+
+void compact_timeline_free(compact_timeline_t *timeline) {
+    free(timeline->data);
+    compact_timeline_init(timeline);
+}
+
+void compact_timeline_clear(compact_timeline_t *timeline) {
+    timeline->size = 0;
+    timeline->count = 0;
+    timeline->end_time = 0;
+    timeline->prev_pid = 0;
+    timeline->prev_end = 0;
+    timeline->prev_duration = 0;
+    timeline->has_pending = 0;
+}
+
+void compact_timeline_append(compact_timeline_t *timeline, int time, int pid, int duration) {
+    timeline_event_t *last = &timeline->pending;
+    if (timeline->has_pending && last->pid == pid && last->time + last->duration == time) {
+        last->duration += duration; // Continúa el mismo proceso: se fusiona
+    } else {
+        flush_pending(timeline);
+        last->time = time;
+        last->pid = pid;
+        last->duration = duration;
+        timeline->has_pending = 1;
+        timeline->count++;
+    }
+    if (time + duration > timeline->end_time) timeline->end_time = time + duration;
+}
+
+void compact_timeline_build(compact_timeline_t *timeline, const timeline_t *source) {
+    compact_timeline_clear(timeline);
+    for (int i = 0; i < source->count; i++) {
+        const timeline_event_t *event = &source->events[i];
+        compact_timeline_append(timeline, event->time, event->pid, event->duration);
+    }
+}
+
+size_t compact_timeline_bytes(const compact_timeline_t *timeline) {
+    return timeline->size + (timeline->has_pending ? sizeof(timeline_event_t) : 0);
+}
+
+// --- Iteración ---
+
+void compact_timeline_iter_init(compact_timeline_iter_t *iter, const compact_timeline_t *timeline) {
+    iter->timeline = timeline;
+    iter->pos = 0;
+    iter->pid = 0;
+    iter->end = 0;
+    iter->duration = 0;
+    iter->pending_done = 0;
+}
+
+int compact_timeline_next(compact_timeline_iter_t *iter, timeline_event_t *event) {
+    const compact_timeline_t *timeline = iter->timeline;
+
+    if (iter->pos < timeline->size) {
+        unsigned long long header = get_varint(timeline->data, &iter->pos);
+        int gap = (header & 1) ? unzigzag(get_varint(timeline->data, &iter->pos)) : 0;
+        event->pid = (int)((unsigned int)iter->pid + (unsigned int)unzigzag(header >> 2));
+        event->time = iter->end + gap;
+        event->duration = (header & 2) ? iter->duration : (int)get_varint(timeline->data, &iter->pos);
+        iter->pid = event->pid;
+        iter->end = event->time + event->duration;
+        iter->duration = event->duration;
+        return 1;
+    }
+
+    // El último segmento sigue sin codificar
+    if (timeline->has_pending && !iter->pending_done) {
+        *event = timeline->pending;
+        iter->pending_done = 1;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,194 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "../include/gantt_lod.h"
+
+// --- Resúmenes ---
+
+static void summary_add(gantt_summary_t *summary, int pid, float piece) {
+    if (pid > 0) summary->busy += piece;
+    summary->covered += piece;
+    if (piece > summary->longest) {
+        summary->longest = piece;
+        summary->pid = pid;
+    }
+}
+
+static void summary_merge(gantt_summary_t *dst, const gantt_summary_t *src) {
+    dst->busy += src->busy;
+    dst->covered += src->covered;
+    if (src->longest > dst->longest) {
+        dst->longest = src->longest;
+        dst->pid = src->pid;
+    }
+}
+
+// --- Construcción ---
+
+/**
+ * @brief Reparte un segmento entre los buckets del nivel 0 que atraviesa.
+ */
+static void add_segment(gantt_lod_t *lod, const timeline_event_t *ev, int end_time) {
+    long long width = lod->bucket_width;
+    long long from = ev->time > 0 ? ev->time : 0;
+    long long to = (long long)ev->time + ev->duration;
+    if (to > end_time) to = end_time;
+
+    for (long long b = from / width; from < to; b++) {
+        long long bucket_end = (b + 1) * width;
+        long long piece_end = to < bucket_end ? to : bucket_end;
+        summary_add(&lod->levels[0][b], ev->pid, (float)(piece_end - from));
+        from = piece_end;
+    }
+}
+
+int gantt_lod_build(gantt_lod_t *lod, const compact_timeline_t *timeline) {
+    memset(lod, 0, sizeof(gantt_lod_t));
+    lod->timeline = timeline;
+
+    int end_time = timeline->end_time;
+    lod->bucket_width = end_time > GANTT_LOD_MAX_BUCKETS
+        ? (int)(((long long)end_time + GANTT_LOD_MAX_BUCKETS - 1) / GANTT_LOD_MAX_BUCKETS) : 1;
+
+    // 1. Espacio para todos los niveles y los puntos de control
+    int size = (int)(((long long)end_time + lod->bucket_width - 1) / lod->bucket_width);
+    while (size > 0 && lod->num_levels < GANTT_LOD_MAX_LEVELS) {
+        lod->levels[lod->num_levels] = calloc(size, sizeof(gantt_summary_t));
+        if (!lod->levels[lod->num_levels]) goto fail;
+        lod->level_size[lod->num_levels++] = size;
+        if (size == 1) break;
+        size = (size + 1) / 2;
+    }
+    int max_checkpoints = (timeline->count + GANTT_LOD_CHECKPOINT - 1) / GANTT_LOD_CHECKPOINT;
+    if (max_checkpoints > 0) {
+        lod->checkpoints = malloc(max_checkpoints * sizeof(compact_timeline_iter_t));
+        lod->checkpoint_time = malloc(max_checkpoints * sizeof(int));
+        if (!lod->checkpoints || !lod->checkpoint_time) goto fail;
+    }
+
+    // 2. Una pasada: nivel 0 y puntos de control
+    compact_timeline_iter_t iter, saved;
+    timeline_event_t ev;
+    compact_timeline_iter_init(&iter, timeline);
+    saved = iter;
+    for (int i = 0; compact_timeline_next(&iter, &ev); i++) {
+        if (i % GANTT_LOD_CHECKPOINT == 0 && lod->num_checkpoints < max_checkpoints) {
+            lod->checkpoints[lod->num_checkpoints] = saved;
+            lod->checkpoint_time[lod->num_checkpoints++] = ev.time;
+        }
+        if (ev.pid != 0 && ev.duration > 0 && lod->num_levels > 0) add_segment(lod, &ev, end_time);
+        saved = iter;
+    }
+
+    // 3. Cada nivel superior combina pares del anterior
+    for (int l = 1; l < lod->num_levels; l++) {
+        const gantt_summary_t *child = lod->levels[l - 1];
+        int child_size = lod->level_size[l - 1];
+        for (int b = 0; b < lod->level_size[l]; b++) {
+            lod->levels[l][b] = child[2 * b];
+            if (2 * b + 1 < child_size) summary_merge(&lod->levels[l][b], &child[2 * b + 1]);
+        }
+    }
+    return 0;
+
+fail:
+    perror("Fallo en la asignación de memoria para el índice del Gantt");
+    gantt_lod_free(lod);
+    return -1;
+}
+
+void gantt_lod_free(gantt_lod_t *lod) {
+    for (int l = 0; l < lod->num_levels; l++) free(lod->levels[l]);
+    free(lod->checkpoints);
+    free(lod->checkpoint_time);
+    memset(lod, 0, sizeof(gantt_lod_t));
+}
+
+// --- Consultas ---
+
+void gantt_lod_seek(const gantt_lod_t *lod, int time, compact_timeline_iter_t *iter) {
+    // Último punto de control que empieza en time o antes
+    int lo = 0, hi = lod->num_checkpoints - 1, found = -1;
+    while (lo <= hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (lod->checkpoint_time[mid] <= time) {
+            found = mid;
+            lo = mid + 1;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    if (found >= 0) {
+        *iter = lod->checkpoints[found];
+        iter->timeline = lod->timeline; // La línea de tiempo pudo moverse tras construir el índice
+    } else {
+        compact_timeline_iter_init(iter, lod->timeline);
+    }
+}
+
+/**
+ * @brief Vista con más detalle que el nivel 0: reparte los segmentos visibles
+ * entre las columnas que atraviesan.
+ */
+static void columns_from_segments(const gantt_lod_t *lod, double start, double units_per_column,
+                                  int columns, gantt_summary_t *out) {
+    double end = start + columns * units_per_column;
+    compact_timeline_iter_t iter;
+    timeline_event_t ev;
+
+    gantt_lod_seek(lod, start > 0 ? (int)start : 0, &iter);
+    while (compact_timeline_next(&iter, &ev) && ev.time < end) {
+        if (ev.pid == 0 || ev.duration <= 0) continue;
+        double from = ev.time > start ? ev.time : start;
+        double to = (double)ev.time + ev.duration;
+        if (to > end) to = end;
+
+        for (int c = (int)((from - start) / units_per_column); from < to && c < columns; c++) {
+            double column_end = start + (c + 1) * units_per_column;
+            double piece_end = to < column_end ? to : column_end;
+            summary_add(&out[c], ev.pid, (float)(piece_end - from));
+            from = piece_end;
+        }
+    }
+}
+
+void gantt_lod_columns(const gantt_lod_t *lod, double start, double units_per_column,
+                       int columns, gantt_summary_t *out) {
+    if (columns <= 0) return;
+    memset(out, 0, columns * sizeof(gantt_summary_t));
+    if (units_per_column <= 0 || lod->num_levels == 0) return;
+
+    if (units_per_column < lod->bucket_width) {
+        columns_from_segments(lod, start, units_per_column, columns, out);
+        return;
+    }
+
+    // Nivel más grueso cuyos buckets no son más anchos que una columna
+    int level = 0;
+    while (level + 1 < lod->num_levels && (double)lod->bucket_width * (2LL << level) <= units_per_column) {
+        level++;
+    }
+    double width = (double)lod->bucket_width * (1LL << level);
+    double end = start + columns * units_per_column;
+    long long first = start > 0 ? (long long)floor(start / width) : 0;
+    long long last = (long long)ceil(end / width);
+    if (last > lod->level_size[level]) last = lod->level_size[level];
+
+    // Cada bucket va a la columna que contiene su centro
+    for (long long b = first; b < last; b++) {
+        long long c = (long long)floor(((b + 0.5) * width - start) / units_per_column);
+        if (c < 0) c = 0;
+        if (c >= columns) c = columns - 1;
+        summary_merge(&out[c], &lod->levels[level][b]);
+    }
+}
+
+double gantt_tick_interval(double min_interval) {
+    if (min_interval <= 1.0) return 1.0;
+    double magnitude = pow(10.0, floor(log10(min_interval)));
+    if (magnitude >= min_interval) return magnitude;
+    if (2 * magnitude >= min_interval) return 2 * magnitude;
+    if (5 * magnitude >= min_interval) return 5 * magnitude;
+    return 10 * magnitude;
+}
@@ -3,29 +3,43 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <math.h>
 
 #include "../include/scheduler.h"
 #include "../include/algorithms.h"
 #include "../include/metrics.h"
+#include "../include/buffers.h"
+#include "../include/workload.h"
+#include "../include/compact_timeline.h"
+#include "../include/gantt_lod.h"
+#include "../include/sim_control.h"
 
 // --- Variables Globales de Estado del Simulador (Simplificadas) ---
 // En una aplicación real, se usaría una estructura de datos para el estado.
-process_t global_processes[MAX_PROCESSES];
+process_set_t global_workload;     // Workload original (sin resultados)
+process_set_t global_process_set;  // Procesos de la simulación (crece dinámicamente)
+process_t *global_processes = NULL;
 int global_num_processes = 3; // Usaremos el Workload 1 de ejemplo
-timeline_event_t global_timeline[MAX_TIMELINE_EVENTS];
+compact_timeline_t global_gantt; // Gantt de la última simulación (segmentos fusionados y codificados)
+gantt_lod_t global_gantt_lod;    // Índice de niveles de detalle sobre global_gantt
 metrics_t global_metrics;
 int global_total_time = 15; // Tiempo máximo de simulación para escala
 
+// Vista del Gantt (zoom y desplazamiento), en unidades de tiempo
+double view_start = 0.0;
+double view_span = 15.0;
+
 // Configuración de MLFQ (ejemplo, para inicializar el widget de parámetros)
 mlfq_config_t mlfq_config = {
     .num_queues = 3,
-    .quantums = (int[]){2, 4, 8}, // Nota: Esto es peligroso en C, mejor usar malloc/free
+    .quantums = {2, 4, 8},
     .boost_interval = 10
 };
 
 // Variable de control del algoritmo actual
 char *current_algorithm = "FIFO";
 int current_quantum = 4; // Para Round Robin
+int current_aging_interval = 5; // Para prioridades (0 = sin aging)
 
 
 // --- Funciones de Utilidad (Carga de Datos de Ejemplo) ---
@@ -33,40 +47,106 @@ int current_quantum = 4; // Para Round Robin
 // Carga el Workload 1 en la variable global
 void load_workload_1() {
     process_t workload_1[] = {
-        {1, 0, 5, 1, 0, -1, 0, 0, 0, 0, 0, 0}, 
-        {2, 1, 3, 2, 0, -1, 0, 0, 0, 0, 0, 0}, 
-        {3, 2, 8, 1, 0, -1, 0, 0, 0, 0, 0, 0}
+        {1, 0, 5, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0}, 
+        {2, 1, 3, 2, 0, -1, 0, 0, 0, 0, 0, 0, 0}, 
+        {3, 2, 8, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0}
     };
     global_num_processes = 3;
-    memcpy(global_processes, workload_1, global_num_processes * sizeof(process_t));
+    global_workload.count = 0;
+    for (int i = 0; i < global_num_processes; i++) {
+        process_set_append(&global_workload, &workload_1[i]);
+    }
+    process_set_reset(&global_process_set, global_workload.items, global_num_processes);
+    global_processes = global_process_set.items;
 }
 
-// Llama al planificador basado en la selección actual
-void run_simulation() {
-    load_workload_1(); // Recargar el estado inicial de los procesos
-    
-    // Asumimos que tienes una función reset_processes para limpiar el estado
-    // (debería estar en scheduler.c o ser incluida aquí)
-    
-    memset(global_timeline, 0, sizeof(global_timeline)); // Limpiar la línea de tiempo
-
-    if (strcmp(current_algorithm, "FIFO") == 0) {
-        schedule_fifo(global_processes, global_num_processes, global_timeline);
-    } else if (strcmp(current_algorithm, "STCF") == 0) {
-        schedule_stcf(global_processes, global_num_processes, global_timeline);
-    } 
-    // ... Implementar llamadas a SJF, RR, MLFQ
-    
-    // Calcular tiempo total y métricas
-    global_total_time = 0;
-    for (int i = 0; i < global_num_processes; i++) {
-        if (global_processes[i].completion_time > global_total_time) {
-            global_total_time = global_processes[i].completion_time;
+// --- Simulación en Segundo Plano ---
+
+/**
+ * @brief Una simulación en un hilo de trabajo. El hilo solo usa datos propios
+ * del trabajo (copias de la configuración y del workload); la interfaz ve los
+ * resultados cuando on_simulation_done los intercambia con los globales, en el
+ * hilo principal, de modo que el Gantt nunca se dibuja a medio actualizar.
+ */
+typedef struct {
+    char algorithm[32];
+    int quantum;
+    int aging_interval;
+    mlfq_config_t mlfq;
+    process_set_t processes;    // Copia del workload; al terminar, con los resultados
+    int num_processes;
+
+    compact_timeline_t gantt;
+    gantt_lod_t gantt_lod;
+    metrics_t metrics;
+    int total_time;
+
+    sim_control_t control;      // Progreso y cancelación
+    atomic_int progress_pending; // Ya hay un show_progress en cola
+    GThread *thread;
+} simulation_job_t;
+
+simulation_job_t *running_job = NULL; // Simulación en curso (solo lo usa el hilo principal)
+
+static void simulation_job_free(simulation_job_t *job) {
+    process_set_free(&job->processes);
+    compact_timeline_free(&job->gantt);
+    gantt_lod_free(&job->gantt_lod);
+    g_free(job);
+}
+
+static gboolean on_simulation_done(gpointer data);
+
+/**
+ * @brief Cuerpo del hilo de trabajo: llama al planificador basado en la
+ * selección y prepara el Gantt y las métricas. Al terminar (o al cancelarse)
+ * avisa al hilo principal con g_idle_add.
+ */
+static gpointer simulation_worker(gpointer data) {
+    simulation_job_t *job = data;
+    process_t *processes = job->processes.items;
+    int n = job->num_processes;
+    timeline_t timeline; // Solo durante la simulación: se guarda la versión compacta
+    timeline_init(&timeline);
+    timeline.control = &job->control;
+
+    if (strcmp(job->algorithm, "FIFO") == 0) {
+        schedule_fifo(processes, n, &timeline);
+    } else if (strcmp(job->algorithm, "SJF") == 0) {
+        schedule_sjf(processes, n, &timeline);
+    } else if (strcmp(job->algorithm, "STCF") == 0) {
+        schedule_stcf(processes, n, &timeline);
+    } else if (strcmp(job->algorithm, "Round Robin") == 0) {
+        schedule_rr(processes, n, job->quantum, &timeline);
+    } else if (strcmp(job->algorithm, "MLFQ") == 0) {
+        schedule_mlfq(processes, n, &job->mlfq, &timeline);
+    } else if (strcmp(job->algorithm, "Priority") == 0 ||
+               strcmp(job->algorithm, "Priority (Preemptive)") == 0) {
+        priority_config_t priority_config = {
+            .preemptive = strcmp(job->algorithm, "Priority (Preemptive)") == 0,
+            .aging_interval = job->aging_interval
+        };
+        schedule_priority(processes, n, &priority_config, &timeline);
+    }
+
+    if (!sim_control_cancelled(&job->control)) {
+        compact_timeline_build(&job->gantt, &timeline);
+        gantt_lod_build(&job->gantt_lod, &job->gantt);
+
+        // Calcular tiempo total y métricas
+        job->total_time = 0;
+        for (int i = 0; i < n; i++) {
+            if (processes[i].completion_time > job->total_time) {
+                job->total_time = processes[i].completion_time;
+            }
         }
+        calculate_metrics(processes, n, job->total_time, &job->metrics);
     }
-    calculate_metrics(global_processes, global_num_processes, global_total_time, &global_metrics);
-}
+    timeline_free(&timeline);
 
+    g_idle_add(on_simulation_done, job);
+    return NULL;
+}
 
 // --- 1. Dibujo del Gráfico de Gantt (Cairo) ---
 
@@ -82,8 +162,51 @@ void assign_color(cairo_t *cr, int pid) {
     }
 }
 
+#define GANTT_MIN_SPAN 4.0          // Zoom máximo: unidades de tiempo visibles
+#define GANTT_ZOOM_STEP 1.25        // Factor de zoom por paso de la rueda
+#define GANTT_PAN_STEP 0.1          // Fracción de la vista por paso de desplazamiento
+#define GANTT_TICK_SPACING 60.0     // Píxeles mínimos entre marcas de tiempo
+
+/**
+ * @brief Mantiene la vista dentro de [0, global_total_time].
+ */
+static void clamp_view() {
+    double total = global_total_time > 0 ? global_total_time : 1.0;
+    double min_span = total < GANTT_MIN_SPAN ? total : GANTT_MIN_SPAN;
+    if (view_span > total) view_span = total;
+    if (view_span < min_span) view_span = min_span;
+    if (view_start > total - view_span) view_start = total - view_span;
+    if (view_start < 0) view_start = 0;
+}
+
+/**
+ * @brief Dibuja un tramo del Gantt y su etiqueta (solo si cabe en el tramo).
+ */
+static void draw_run(cairo_t *cr, int pid, double x, double w, double y, double h) {
+    if (pid > 0) {
+        assign_color(cr, pid);
+    } else {
+        cairo_set_source_rgb(cr, 0.7, 0.7, 0.7); // IDLE: gris claro
+    }
+    cairo_rectangle(cr, x, y, w, h);
+    cairo_fill(cr);
+    if (pid <= 0) return;
+
+    char label[16];
+    cairo_text_extents_t extents;
+    snprintf(label, sizeof(label), "P%d", pid);
+    cairo_text_extents(cr, label, &extents);
+    if (extents.width + 4.0 > w) return;
+    cairo_set_source_rgb(cr, 0.0, 0.0, 0.0);
+    cairo_move_to(cr, x + (w - extents.width) / 2.0 - extents.x_bearing, y + (h + extents.height) / 2.0);
+    cairo_show_text(cr, label);
+}
+
 /**
  * @brief Función callback de GTK para dibujar el Gráfico de Gantt.
+ * Solo se dibuja la vista actual: el índice de niveles de detalle resume cada
+ * columna de píxeles (el costo depende del ancho, no del número de segmentos) y
+ * las columnas contiguas del mismo proceso se dibujan como un solo rectángulo.
  */
 static gboolean draw_gantt_chart(GtkWidget *widget, cairo_t *cr, gpointer user_data) {
     if (global_total_time <= 0) return FALSE; // No dibujar si no hay simulación
@@ -92,48 +215,35 @@ static gboolean draw_gantt_chart(GtkWidget *widget, cairo_t *cr, gpointer user_d
     gtk_widget_get_allocation(widget, &allocation);
     double width = (double)allocation.width;
     double height = (double)allocation.height;
+    int columns = allocation.width;
+    if (columns <= 0) return FALSE;
     
     // Espacio para la escala de tiempo
     double chart_height = height * 0.75;
     double time_scale_y = height * 0.85;
 
-    // Escala de píxeles por unidad de tiempo
-    double pixels_per_unit = width / (double)global_total_time;
+    // Escala de unidades de tiempo por píxel según el zoom
+    clamp_view();
+    double units_per_pixel = view_span / width;
 
     // 1. Dibujar el fondo
     cairo_set_source_rgb(cr, 0.95, 0.95, 0.95);
     cairo_rectangle(cr, 0, 0, width, chart_height);
     cairo_fill(cr);
 
-    // 2. Dibujar la línea de tiempo
+    // 2. Dibujar la línea de tiempo visible, una columna de píxeles a la vez
     double bar_height = chart_height * 0.4;
     double y_start = (chart_height - bar_height) / 2.0;
 
-    for (int i = 0; global_timeline[i].pid != 0; i++) {
-        int pid = global_timeline[i].pid;
-        int duration = global_timeline[i].duration;
-        
-        double x = global_timeline[i].time * pixels_per_unit;
-        double w = duration * pixels_per_unit;
-
-        if (pid > 0) { // Proceso
-            assign_color(cr, pid);
-            cairo_rectangle(cr, x, y_start, w, bar_height);
-            cairo_fill(cr);
-
-            // Texto (PID)
-            cairo_set_source_rgb(cr, 0.0, 0.0, 0.0);
-            char label[10];
-            sprintf(label, "P%d", pid);
-            cairo_move_to(cr, x + (w / 2.0) - 5.0, y_start + bar_height / 2.0 + 5.0);
-            cairo_show_text(cr, label);
-            
-        } else if (pid == -1) { // IDLE
-            cairo_set_source_rgb(cr, 0.7, 0.7, 0.7); // Gris claro
-            cairo_rectangle(cr, x, y_start, w, bar_height);
-            cairo_fill(cr);
-        }
+    gantt_summary_t *summary = g_new(gantt_summary_t, columns);
+    gantt_lod_columns(&global_gantt_lod, view_start, units_per_pixel, columns, summary);
+    for (int c = 0; c < columns;) {
+        int run_end = c + 1;
+        while (run_end < columns && summary[run_end].pid == summary[c].pid) run_end++;
+        if (summary[c].pid != 0) draw_run(cr, summary[c].pid, c, run_end - c, y_start, bar_height);
+        c = run_end;
     }
+    g_free(summary);
     
     // 3. Dibujar la escala de tiempo (ejes X)
     cairo_set_source_rgb(cr, 0.0, 0.0, 0.0);
@@ -142,17 +252,17 @@ static gboolean draw_gantt_chart(GtkWidget *widget, cairo_t *cr, gpointer user_d
     cairo_line_to(cr, width, time_scale_y);
     cairo_stroke(cr);
     
-    // Marcas de tiempo (cada 5 unidades de tiempo o menos si el total es pequeño)
-    int interval = (global_total_time > 10) ? 5 : 1;
-    for (int t = 0; t <= global_total_time; t += interval) {
-        double x = t * pixels_per_unit;
+    // Marcas de tiempo con una separación legible para el zoom actual
+    double interval = gantt_tick_interval(GANTT_TICK_SPACING * units_per_pixel);
+    for (double t = ceil(view_start / interval) * interval; t <= view_start + view_span; t += interval) {
+        double x = (t - view_start) / units_per_pixel;
         cairo_move_to(cr, x, time_scale_y);
         cairo_line_to(cr, x, time_scale_y + 5);
         cairo_stroke(cr);
 
         // Número de tiempo
-        char time_label[10];
-        sprintf(time_label, "%d", t);
+        char time_label[16];
+        snprintf(time_label, sizeof(time_label), "%.0f", t);
         cairo_move_to(cr, x - 5, time_scale_y + 15);
         cairo_show_text(cr, time_label);
     }
@@ -160,12 +270,75 @@ static gboolean draw_gantt_chart(GtkWidget *widget, cairo_t *cr, gpointer user_d
     return FALSE;
 }
 
+// --- Zoom y Desplazamiento del Gantt ---
+
+static double drag_x;            // Posición del puntero al empezar a arrastrar
+static double drag_view_start;   // view_start al empezar a arrastrar
+
+/**
+ * @brief Rueda: zoom alrededor del puntero. Shift + rueda o rueda horizontal: desplazamiento.
+ */
+static gboolean on_gantt_scroll(GtkWidget *widget, GdkEventScroll *event, gpointer data) {
+    double delta = 0.0;
+    int pan = (event->state & GDK_SHIFT_MASK) != 0;
+    switch (event->direction) {
+        case GDK_SCROLL_UP: delta = -1.0; break;
+        case GDK_SCROLL_DOWN: delta = 1.0; break;
+        case GDK_SCROLL_LEFT: delta = -1.0; pan = 1; break;
+        case GDK_SCROLL_RIGHT: delta = 1.0; pan = 1; break;
+        case GDK_SCROLL_SMOOTH:
+            if (event->delta_x != 0.0) {
+                delta = event->delta_x;
+                pan = 1;
+            } else {
+                delta = event->delta_y;
+            }
+            break;
+        default: return FALSE;
+    }
+
+    if (pan) {
+        view_start += delta * GANTT_PAN_STEP * view_span;
+    } else {
+        double fraction = event->x / gtk_widget_get_allocated_width(widget);
+        double anchor = view_start + fraction * view_span; // Instante bajo el puntero
+        view_span *= pow(GANTT_ZOOM_STEP, delta);
+        clamp_view();
+        view_start = anchor - fraction * view_span;
+    }
+    clamp_view();
+    gtk_widget_queue_draw(widget);
+    return TRUE;
+}
+
+static gboolean on_gantt_button_press(GtkWidget *widget, GdkEventButton *event, gpointer data) {
+    if (event->button != 1) return FALSE;
+    drag_x = event->x;
+    drag_view_start = view_start;
+    return TRUE;
+}
+
+/**
+ * @brief Arrastrar con el botón izquierdo desplaza la vista.
+ */
+static gboolean on_gantt_motion(GtkWidget *widget, GdkEventMotion *event, gpointer data) {
+    if (!(event->state & GDK_BUTTON1_MASK)) return FALSE;
+    double units_per_pixel = view_span / gtk_widget_get_allocated_width(widget);
+    view_start = drag_view_start - (event->x - drag_x) * units_per_pixel;
+    clamp_view();
+    gtk_widget_queue_draw(widget);
+    return TRUE;
+}
+
 // --- 2. Funciones de Callback y UI Update ---
 
 GtkLabel *lbl_avg_tat;
 GtkLabel *lbl_avg_wt;
 GtkLabel *lbl_avg_rt;
 GtkWidget *gantt_area;
+GtkWidget *run_button;
+GtkWidget *cancel_button;
+GtkWidget *progress_bar;
 
 /**
  * @brief Actualiza las etiquetas de métricas con los resultados de la simulación.
@@ -187,12 +360,124 @@ void update_metrics_display() {
 }
 
 /**
- * @brief Callback cuando se presiona el botón "Run Simulation".
+ * @brief Habilita Run o Cancel según haya una simulación en curso.
+ */
+static void set_running_ui(gboolean running) {
+    gtk_widget_set_sensitive(run_button, !running);
+    gtk_widget_set_sensitive(cancel_button, running);
+    if (running) {
+        gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progress_bar), 0.0);
+        gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), "Simulando...");
+    }
+}
+
+/**
+ * @brief Muestra el progreso publicado por el hilo de trabajo (en el hilo principal).
+ */
+static gboolean show_progress(gpointer data) {
+    simulation_job_t *job = data;
+    atomic_store(&job->progress_pending, 0);
+    if (sim_control_cancelled(&job->control)) return G_SOURCE_REMOVE;
+
+    int completed = atomic_load(&job->control.completed);
+    char text[100];
+    snprintf(text, sizeof(text), "t = %d · %d/%d procesos terminados",
+             atomic_load(&job->control.time), completed, job->num_processes);
+    gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progress_bar),
+                                  job->num_processes > 0 ? (double)completed / job->num_processes : 0.0);
+    gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), text);
+    return G_SOURCE_REMOVE;
+}
+
+/**
+ * @brief Callback de progreso del planificador (en el hilo de trabajo): encola
+ * show_progress si no hay uno pendiente. Como on_simulation_done se encola
+ * después desde el mismo hilo y con la misma prioridad, show_progress nunca
+ * se ejecuta con el trabajo ya liberado.
+ */
+static void on_simulation_progress(sim_control_t *control) {
+    simulation_job_t *job = control->user_data;
+    if (!atomic_exchange(&job->progress_pending, 1)) g_idle_add(show_progress, job);
+}
+
+/**
+ * @brief Fin del hilo de trabajo (en el hilo principal): si no se canceló,
+ * intercambia los resultados con los globales y redibuja.
+ */
+static gboolean on_simulation_done(gpointer data) {
+    simulation_job_t *job = data;
+    g_thread_join(job->thread);
+    running_job = NULL;
+
+    if (sim_control_cancelled(&job->control)) {
+        gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), "Simulación cancelada");
+        printf("Simulación cancelada: %s\n", job->algorithm);
+    } else {
+        // Los resultados anteriores quedan en el trabajo y se liberan con él
+        process_set_t processes = global_process_set;
+        global_process_set = job->processes;
+        job->processes = processes;
+        global_processes = global_process_set.items;
+
+        compact_timeline_t gantt = global_gantt;
+        global_gantt = job->gantt;
+        job->gantt = gantt;
+        gantt_lod_free(&global_gantt_lod);
+        global_gantt_lod = job->gantt_lod;
+        global_gantt_lod.timeline = &global_gantt; // El índice apuntaba a la copia del trabajo
+        memset(&job->gantt_lod, 0, sizeof(gantt_lod_t));
+
+        global_metrics = job->metrics;
+        global_total_time = job->total_time;
+
+        // Cada simulación nueva se muestra completa
+        view_start = 0.0;
+        view_span = global_total_time;
+
+        gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progress_bar), 1.0);
+        gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), "Simulación completa");
+        update_metrics_display();
+        printf("Simulación ejecutada para el algoritmo: %s\n", job->algorithm);
+    }
+
+    set_running_ui(FALSE);
+    simulation_job_free(job);
+    return G_SOURCE_REMOVE;
+}
+
+/**
+ * @brief Callback cuando se presiona el botón "Run Simulation": lanza la
+ * simulación en un hilo de trabajo para no bloquear la interfaz.
  */
 static void on_run_clicked(GtkWidget *widget, gpointer data) {
-    run_simulation();
-    update_metrics_display();
-    printf("Simulación ejecutada para el algoritmo: %s\n", current_algorithm);
+    if (running_job) return;
+
+    simulation_job_t *job = g_new0(simulation_job_t, 1);
+    g_strlcpy(job->algorithm, current_algorithm ? current_algorithm : "FIFO", sizeof(job->algorithm));
+    job->quantum = current_quantum;
+    job->aging_interval = current_aging_interval;
+    job->mlfq = mlfq_config;
+    process_set_init(&job->processes);
+    process_set_reset(&job->processes, global_workload.items, global_num_processes);
+    job->num_processes = global_num_processes;
+    compact_timeline_init(&job->gantt);
+    sim_control_init(&job->control, on_simulation_progress, job);
+    atomic_init(&job->progress_pending, 0);
+
+    running_job = job;
+    set_running_ui(TRUE);
+    job->thread = g_thread_new("simulacion", simulation_worker, job);
+}
+
+/**
+ * @brief Callback del botón "Cancel": el planificador se detiene en su
+ * siguiente punto de control y on_simulation_done descarta los resultados.
+ */
+static void on_cancel_clicked(GtkWidget *widget, gpointer data) {
+    if (!running_job) return;
+    sim_control_cancel(&running_job->control);
+    gtk_widget_set_sensitive(cancel_button, FALSE);
+    gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), "Cancelando...");
 }
 
 /**
@@ -219,8 +504,10 @@ static void activate(GtkApplication *app, gpointer user_data) {
     GtkWidget *frame_gantt;
     GtkWidget *frame_metrics;
 
-    // 0. Inicializar la simulación con datos de ejemplo
-    load_workload_1();
+    // 0. Inicializar la simulación con datos de ejemplo si no se cargó un workload
+    if (global_workload.count == 0) {
+        load_workload_1();
+    }
 
     // Ventana Principal
     window = gtk_application_window_new(app);
@@ -244,18 +531,30 @@ static void activate(GtkApplication *app, gpointer user_data) {
     gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(algo_combo), "STCF");
     gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(algo_combo), "Round Robin");
     gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(algo_combo), "MLFQ");
+    gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(algo_combo), "Priority");
+    gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(algo_combo), "Priority (Preemptive)");
     gtk_combo_box_set_active(GTK_COMBO_BOX(algo_combo), 0); // FIFO por defecto
     g_signal_connect(algo_combo, "changed", G_CALLBACK(on_algorithm_changed), NULL);
 
     // Botón Run
-    GtkWidget *run_button = gtk_button_new_with_label("▶️ Run Simulation");
+    run_button = gtk_button_new_with_label("▶️ Run Simulation");
     g_signal_connect(run_button, "clicked", G_CALLBACK(on_run_clicked), NULL);
 
+    // Botón Cancel y progreso de la simulación en curso
+    cancel_button = gtk_button_new_with_label("⏹ Cancel");
+    g_signal_connect(cancel_button, "clicked", G_CALLBACK(on_cancel_clicked), NULL);
+    gtk_widget_set_sensitive(cancel_button, FALSE);
+    progress_bar = gtk_progress_bar_new();
+    gtk_progress_bar_set_show_text(GTK_PROGRESS_BAR(progress_bar), TRUE);
+    gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), "Sin simular");
+
     // Empaquetar Controles
     gtk_box_pack_start(GTK_BOX(hbox_controls), algo_label, FALSE, FALSE, 5);
     gtk_box_pack_start(GTK_BOX(hbox_controls), algo_combo, FALSE, FALSE, 5);
     // Aquí iría el input del Quantum/Prioridad...
     gtk_box_pack_start(GTK_BOX(hbox_controls), run_button, FALSE, FALSE, 15);
+    gtk_box_pack_start(GTK_BOX(hbox_controls), cancel_button, FALSE, FALSE, 5);
+    gtk_box_pack_start(GTK_BOX(hbox_controls), progress_bar, TRUE, TRUE, 5);
 
     // --- B. Gráfico de Gantt ---
     frame_gantt = gtk_frame_new("Gráfico de Gantt");
@@ -264,6 +563,12 @@ static void activate(GtkApplication *app, gpointer user_data) {
     gantt_area = gtk_drawing_area_new();
     gtk_widget_set_size_request(gantt_area, 750, 150); // Tamaño inicial
     g_signal_connect(G_OBJECT(gantt_area), "draw", G_CALLBACK(draw_gantt_chart), NULL);
+    gtk_widget_add_events(gantt_area, GDK_SCROLL_MASK | GDK_SMOOTH_SCROLL_MASK |
+                                      GDK_BUTTON_PRESS_MASK | GDK_BUTTON1_MOTION_MASK);
+    g_signal_connect(G_OBJECT(gantt_area), "scroll-event", G_CALLBACK(on_gantt_scroll), NULL);
+    g_signal_connect(G_OBJECT(gantt_area), "button-press-event", G_CALLBACK(on_gantt_button_press), NULL);
+    g_signal_connect(G_OBJECT(gantt_area), "motion-notify-event", G_CALLBACK(on_gantt_motion), NULL);
+    gtk_widget_set_tooltip_text(gantt_area, "Rueda: zoom · Arrastrar o Shift + rueda: desplazar");
     gtk_container_add(GTK_CONTAINER(frame_gantt), gantt_area);
 
     // --- C. Dashboard de Métricas ---
@@ -302,11 +607,38 @@ int main(int argc, char **argv) {
     GtkApplication *app;
     int status;
 
+    process_set_init(&global_workload);
+    process_set_init(&global_process_set);
+    compact_timeline_init(&global_gantt);
+
+    // Uso: scheduler_simulator_gtk [workload.txt] (por defecto, el Workload 1)
+    // GApplication no acepta archivos como argumento, así que se consume aquí.
+    if (argc > 1) {
+        if (load_workload(argv[1], &global_workload) != 0) {
+            return 1;
+        }
+        global_num_processes = global_workload.count;
+        process_set_reset(&global_process_set, global_workload.items, global_num_processes);
+        global_processes = global_process_set.items;
+        argc = 1;
+    }
+
     // Inicializar el sistema GTK
     app = gtk_application_new("org.example.cpuscheduler", G_APPLICATION_DEFAULT_FLAGS);
     g_signal_connect(app, "activate", G_CALLBACK(activate), NULL);
     status = g_application_run(G_APPLICATION(app), argc, argv);
     g_object_unref(app);
 
+    // Si se cerró la ventana con una simulación en curso, se detiene antes de salir
+    if (running_job) {
+        sim_control_cancel(&running_job->control);
+        g_thread_join(running_job->thread);
+        simulation_job_free(running_job);
+    }
+
+    compact_timeline_free(&global_gantt);
+    gantt_lod_free(&global_gantt_lod);
+    process_set_free(&global_process_set);
+    process_set_free(&global_workload);
     return status;
 }
@@ -2,10 +2,15 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <math.h>
 
 #include "../include/scheduler.h"
 #include "../include/algorithms.h"
 #include "../include/metrics.h"
+#include "../include/buffers.h"
+#include "../include/workload.h"
+#include "../include/compact_timeline.h"
+#include "../include/gantt_lod.h"
 
 // --- Constantes y Definiciones de Ventanas ---
 #define MAX_ROWS 30
@@ -17,14 +22,28 @@
 #define HEIGHT_GANTT 5
 #define HEIGHT_METRICS 8
 
+// Vista del Gantt
+#define GANTT_SCROLL_CELLS 10       // Celdas por pulsación de las flechas
+#define GANTT_ZOOM_FACTOR 2.0       // Factor de zoom de las teclas + y -
+
 // --- Variables Globales de Estado del Simulador ---
-process_t global_processes[MAX_PROCESSES];
+process_set_t global_workload;     // Workload original (sin resultados)
+process_set_t global_process_set;  // Copia de trabajo con los resultados de la simulación
+process_t *global_processes = NULL;
 int global_num_processes = 3; 
-timeline_event_t global_timeline[MAX_TIMELINE_EVENTS];
+compact_timeline_t global_gantt; // Gantt de la última simulación (segmentos fusionados y codificados)
+gantt_lod_t global_gantt_lod;    // Índice de niveles de detalle sobre global_gantt
+double view_start = 0.0;         // Primer instante visible del Gantt
+double view_units_per_cell = 1.0; // Unidades de tiempo por carácter (zoom)
 metrics_t global_metrics;
 int global_total_time = 0; 
 char current_algorithm_name[20] = "FIFO";
 int current_quantum = 4;
+int current_aging_interval = 5; // Para prioridades (0 = sin aging)
+
+// Algoritmos que recorre la tecla 'A', en orden
+static const char *algorithm_names[] = {"FIFO", "SJF", "STCF", "RR", "Priority", "Priority (P)"};
+#define NUM_ALGORITHM_NAMES (int)(sizeof(algorithm_names) / sizeof(algorithm_names[0]))
 
 // Ventanas de ncurses
 WINDOW *win_main;
@@ -39,27 +58,48 @@ WINDOW *win_footer;
 // Carga el Workload 1 de ejemplo
 void load_workload_1() {
     process_t workload_1[] = {
-        {1, 0, 5, 1, 0, -1, 0, 0, 0, 0, 0, 0}, 
-        {2, 1, 3, 2, 0, -1, 0, 0, 0, 0, 0, 0}, 
-        {3, 2, 8, 1, 0, -1, 0, 0, 0, 0, 0, 0}
+        {1, 0, 5, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0}, 
+        {2, 1, 3, 2, 0, -1, 0, 0, 0, 0, 0, 0, 0}, 
+        {3, 2, 8, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0}
     };
     global_num_processes = 3;
-    memcpy(global_processes, workload_1, global_num_processes * sizeof(process_t));
+    global_workload.count = 0;
+    for (int i = 0; i < global_num_processes; i++) {
+        process_set_append(&global_workload, &workload_1[i]);
+    }
+    process_set_reset(&global_process_set, global_workload.items, global_num_processes);
+    global_processes = global_process_set.items;
 }
 
 // Llama al planificador y calcula métricas (Misma lógica que en gui_gtk.c)
 void run_simulation() {
-    // Nota: Aquí se debería llamar a reset_processes para limpiar los datos
-    memset(global_timeline, 0, sizeof(global_timeline)); 
+    // Restablecer los procesos para que cada ejecución parta de datos limpios
+    process_set_reset(&global_process_set, global_workload.items, global_num_processes);
+    global_processes = global_process_set.items;
+    timeline_t timeline; // Solo durante la simulación: se guarda la versión compacta
+    timeline_init(&timeline);
     
     // Ejecutar el algoritmo seleccionado
     if (strcmp(current_algorithm_name, "FIFO") == 0) {
-        schedule_fifo(global_processes, global_num_processes, global_timeline);
+        schedule_fifo(global_processes, global_num_processes, &timeline);
+    } else if (strcmp(current_algorithm_name, "SJF") == 0) {
+        schedule_sjf(global_processes, global_num_processes, &timeline);
     } else if (strcmp(current_algorithm_name, "STCF") == 0) {
-        schedule_stcf(global_processes, global_num_processes, global_timeline);
-    } 
-    // ... Más llamadas a algoritmos ...
-    
+        schedule_stcf(global_processes, global_num_processes, &timeline);
+    } else if (strcmp(current_algorithm_name, "RR") == 0) {
+        schedule_rr(global_processes, global_num_processes, current_quantum, &timeline);
+    } else if (strncmp(current_algorithm_name, "Priority", 8) == 0) {
+        priority_config_t priority_config = {
+            .preemptive = strcmp(current_algorithm_name, "Priority (P)") == 0,
+            .aging_interval = current_aging_interval
+        };
+        schedule_priority(global_processes, global_num_processes, &priority_config, &timeline);
+    }
+    compact_timeline_build(&global_gantt, &timeline);
+    timeline_free(&timeline);
+    gantt_lod_free(&global_gantt_lod);
+    gantt_lod_build(&global_gantt_lod, &global_gantt);
+
     // Calcular tiempo total y métricas
     global_total_time = 0;
     for (int i = 0; i < global_num_processes; i++) {
@@ -68,6 +108,10 @@ void run_simulation() {
         }
     }
     calculate_metrics(global_processes, global_num_processes, global_total_time, &global_metrics);
+
+    // Cada simulación nueva se muestra completa
+    view_start = 0.0;
+    view_units_per_cell = 0.0;
 }
 
 // --- Funciones de Dibujo (ncurses) ---
@@ -106,32 +150,78 @@ void draw_controls_window() {
     wclear(win_controls);
     box(win_controls, 0, 0);
     
-    mvwprintw(win_controls, 1, 2, "Algorithm: [%s] Quantum: [%d] (Use 'A' to change)", 
-              current_algorithm_name, current_quantum);
+    mvwprintw(win_controls, 1, 2, "Algorithm: [%s] Quantum: [%d] Aging: [%d] (Use 'A' to change)",
+              current_algorithm_name, current_quantum, current_aging_interval);
     
     wrefresh(win_controls);
 }
 
+/**
+ * @brief Celdas disponibles para el Gantt (ancho de la ventana sin el borde).
+ */
+static int gantt_cells() {
+    return getmaxx(win_gantt) - 2;
+}
+
+/**
+ * @brief Mantiene el zoom entre 1 unidad por carácter y la simulación completa
+ * en el ancho de la ventana, y la vista dentro de [0, global_total_time].
+ * Un zoom de 0 (nueva simulación) muestra la simulación completa.
+ */
+static void clamp_view() {
+    int cells = gantt_cells();
+    double fit = (double)global_total_time / cells;
+    if (fit < 1.0) fit = 1.0;
+    if (view_units_per_cell <= 0.0 || view_units_per_cell > fit) view_units_per_cell = fit;
+    if (view_units_per_cell < 1.0) view_units_per_cell = 1.0;
+
+    double max_start = global_total_time - cells * view_units_per_cell;
+    if (view_start > max_start) view_start = max_start;
+    if (view_start < 0.0) view_start = 0.0;
+}
+
+/**
+ * @brief Carácter de densidad según la fracción del tiempo resumido en la celda
+ * que estuvo ocupada por procesos.
+ */
+static char density_glyph(const gantt_summary_t *summary) {
+    double busy_fraction = summary->covered > 0 ? summary->busy / summary->covered : 0.0;
+    if (busy_fraction <= 0.0) return ' ';
+    if (busy_fraction <= 0.25) return '.';
+    if (busy_fraction <= 0.5) return ':';
+    if (busy_fraction <= 0.75) return '+';
+    return '#';
+}
+
 /**
  * @brief Dibuja el Gráfico de Gantt en modo texto.
+ * Cada carácter resume view_units_per_cell unidades de tiempo a partir del
+ * índice de niveles de detalle: la primera fila muestra el proceso dominante
+ * (último dígito del PID, '-' si predomina IDLE) y la segunda, qué fracción de
+ * ese tiempo estuvo ocupada. El costo depende del ancho, no del número de eventos.
  */
 void draw_gantt_window() {
     wclear(win_gantt);
     box(win_gantt, 0, 0);
-    mvwprintw(win_gantt, 0, 2, " Gantt Chart ");
-    
-    // Fila de ejecución
-    int row = 1;
-    int col = 1;
-    
-    // Mapeo simple de tiempo a caracteres (1 unidad de tiempo = 1 carácter)
-    int max_gantt_width = getmaxx(win_gantt) - 2; 
 
-    for (int i = 0; global_timeline[i].pid != 0 && col < max_gantt_width; i++) {
-        char label;
-        int pid = global_timeline[i].pid;
-        int duration = global_timeline[i].duration;
+    int cells = gantt_cells();
+    clamp_view();
+    double view_end = view_start + cells * view_units_per_cell;
+    if (view_end > global_total_time) view_end = global_total_time;
+    mvwprintw(win_gantt, 0, 2, " Gantt Chart [%.0f-%.0f] (<-/-> scroll, +/- zoom, F fit) ",
+              view_start, view_end);
 
+    // Fila de ejecución y fila de densidad
+    int row = 1;
+    gantt_summary_t *summary = malloc(cells * sizeof(gantt_summary_t));
+    if (!summary) {
+        wrefresh(win_gantt);
+        return;
+    }
+    gantt_lod_columns(&global_gantt_lod, view_start, view_units_per_cell, cells, summary);
+    for (int c = 0; c < cells; c++) {
+        char label;
+        int pid = summary[c].pid;
         if (pid == -1) {
             label = '-'; // IDLE
         } else if (pid > 0) {
@@ -139,20 +229,42 @@ void draw_gantt_window() {
         } else {
             label = ' '; // Espacio vacío
         }
-        
-        for (int d = 0; d < duration && col < max_gantt_width; d++) {
-            mvwaddch(win_gantt, row, col++, label);
-        }
+        mvwaddch(win_gantt, row, c + 1, label);
+        if (pid != 0) mvwaddch(win_gantt, row + 1, c + 1, density_glyph(&summary[c]));
     }
-    
-    // Fila de escala de tiempo (cada 5 unidades)
-    for (int t = 0; t <= global_total_time && t < max_gantt_width; t += 5) {
-        mvwprintw(win_gantt, row + 1, t + 1, "%d", t);
+    free(summary);
+
+    // Fila de escala de tiempo: marcas redondas, separadas lo suficiente para sus números
+    char time_label[16];
+    int label_width = snprintf(time_label, sizeof(time_label), "%d", global_total_time) + 1;
+    double interval = gantt_tick_interval((label_width > 5 ? label_width : 5) * view_units_per_cell);
+    for (double t = ceil(view_start / interval) * interval; t <= view_end; t += interval) {
+        int col = 1 + (int)((t - view_start) / view_units_per_cell);
+        int len = snprintf(time_label, sizeof(time_label), "%.0f", t);
+        if (col + len > cells + 1) break;
+        mvwprintw(win_gantt, row + 2, col, "%s", time_label);
     }
     
     wrefresh(win_gantt);
 }
 
+/**
+ * @brief Desplaza la vista del Gantt (en celdas) o cambia el zoom manteniendo
+ * el centro de la vista.
+ */
+static void move_gantt_view(int scroll_cells, double zoom) {
+    int cells = gantt_cells();
+    if (zoom != 1.0) {
+        double center = view_start + cells * view_units_per_cell / 2.0;
+        view_units_per_cell /= zoom;
+        if (view_units_per_cell < 1.0) view_units_per_cell = 1.0;
+        view_start = center - cells * view_units_per_cell / 2.0;
+    }
+    view_start += scroll_cells * view_units_per_cell;
+    clamp_view();
+    draw_gantt_window();
+}
+
 /**
  * @brief Dibuja la sección de métricas.
  */
@@ -253,15 +365,36 @@ void main_loop() {
                 break;
             case 'a':
             case 'A':
-                // Lógica para cambiar el algoritmo (requiere sub-rutina de entrada)
-                // Aquí solo se simula el cambio
-                if (strcmp(current_algorithm_name, "FIFO") == 0) {
-                    strcpy(current_algorithm_name, "STCF");
-                } else {
-                    strcpy(current_algorithm_name, "FIFO");
+                // Pasar al siguiente algoritmo de la lista (cíclico)
+                for (int i = 0; i < NUM_ALGORITHM_NAMES; i++) {
+                    if (strcmp(current_algorithm_name, algorithm_names[i]) == 0) {
+                        snprintf(current_algorithm_name, sizeof(current_algorithm_name), "%s",
+                                 algorithm_names[(i + 1) % NUM_ALGORITHM_NAMES]);
+                        break;
+                    }
                 }
                 draw_controls_window();
                 break;
+            case KEY_LEFT:
+                move_gantt_view(-GANTT_SCROLL_CELLS, 1.0);
+                break;
+            case KEY_RIGHT:
+                move_gantt_view(GANTT_SCROLL_CELLS, 1.0);
+                break;
+            case '+':
+            case '=':
+                move_gantt_view(0, GANTT_ZOOM_FACTOR);
+                break;
+            case '-':
+                move_gantt_view(0, 1.0 / GANTT_ZOOM_FACTOR);
+                break;
+            case 'f':
+            case 'F':
+                // Ajustar la simulación completa al ancho de la ventana
+                view_start = 0.0;
+                view_units_per_cell = 0.0;
+                draw_gantt_window();
+                break;
             case 'e':
             case 'E':
                 // Lógica para editar procesos (requiere sub-rutina de entrada/edición)
@@ -277,8 +410,22 @@ void main_loop() {
     }
 }
 
-int main() {
-    load_workload_1();
+int main(int argc, char **argv) {
+    process_set_init(&global_workload);
+    process_set_init(&global_process_set);
+    compact_timeline_init(&global_gantt);
+
+    // Uso: scheduler_simulator_ncurses [workload.txt] (por defecto, el Workload 1)
+    if (argc > 1) {
+        if (load_workload(argv[1], &global_workload) != 0) {
+            return 1;
+        }
+        global_num_processes = global_workload.count;
+        process_set_reset(&global_process_set, global_workload.items, global_num_processes);
+        global_processes = global_process_set.items;
+    } else {
+        load_workload_1();
+    }
 
     setup_ncurses();
     
@@ -290,5 +437,9 @@ int main() {
 
     cleanup_ncurses();
 
+    compact_timeline_free(&global_gantt);
+    gantt_lod_free(&global_gantt_lod);
+    process_set_free(&global_process_set);
+    process_set_free(&global_workload);
     return 0;
 }
@@ -0,0 +1,62 @@
+#include <string.h>
+#include <math.h>
+#include "../include/histogram.h"
+
+/**
+ * @brief Bucket de un valor: exacto por debajo de 2^HISTOGRAM_SUB_BITS; por
+ * encima, se conservan los HISTOGRAM_SUB_BITS bits más significativos.
+ */
+static int bucket_of(int value) {
+    if (value < 2 * HISTOGRAM_HALF) return value;
+    int shift = (31 - __builtin_clz((unsigned)value)) - (HISTOGRAM_SUB_BITS - 1);
+    return HISTOGRAM_HALF * shift + (value >> shift);
+}
+
+/**
+ * @brief Mayor valor que cae en el bucket indicado.
+ */
+static long long bucket_highest(int bucket) {
+    if (bucket < 2 * HISTOGRAM_HALF) return bucket;
+    int shift = bucket / HISTOGRAM_HALF - 1;
+    long long base = (long long)(bucket - HISTOGRAM_HALF * shift) << shift;
+    return base + (1LL << shift) - 1;
+}
+
+void histogram_init(histogram_t *hist) {
+    memset(hist->counts, 0, sizeof(hist->counts));
+    hist->total = 0;
+    hist->max = 0;
+    hist->last_bucket = 0;
+}
+
+void histogram_record(histogram_t *hist, int value) {
+    if (value < 0) value = 0;
+    int bucket = bucket_of(value);
+    hist->counts[bucket]++;
+    hist->total++;
+    if (value > hist->max) hist->max = value;
+    if (bucket > hist->last_bucket) hist->last_bucket = bucket;
+}
+
+int histogram_percentile(const histogram_t *hist, double percentile) {
+    if (hist->total == 0) return 0;
+    if (percentile >= 100.0) return hist->max;
+
+    // Rango más cercano: el valor en la posición ceil(p/100 * total) (1-indexada).
+    // Se calcula en enteros con p en milésimas de punto: en double, p/100 * total
+    // puede quedar apenas por encima de un rango exacto (99.9% de 1000 = 999.0000001)
+    // y ceil lo llevaría al siguiente.
+    long long p_milli = llround(percentile * 1000.0);
+    long long rank = (p_milli * hist->total + 99999) / 100000;
+    if (rank < 1) rank = 1;
+
+    long long seen = 0;
+    for (int bucket = 0; bucket <= hist->last_bucket; bucket++) {
+        seen += hist->counts[bucket];
+        if (seen >= rank) {
+            long long value = bucket_highest(bucket);
+            return value < hist->max ? (int)value : hist->max;
+        }
+    }
+    return hist->max;
+}
@@ -2,9 +2,21 @@
 #include <math.h>
 #include "../include/scheduler.h"
 #include "../include/metrics.h"
+#include "../include/histogram.h"
 
 // Nota: Asume que las estructuras process_t y metrics_t están definidas en scheduler.h
 
+/**
+ * @brief Extrae P50/P90/P99/P99.9 y el máximo de un histograma.
+ */
+static void fill_percentiles(const histogram_t *hist, percentiles_t *out) {
+    out->p50 = histogram_percentile(hist, 50.0);
+    out->p90 = histogram_percentile(hist, 90.0);
+    out->p99 = histogram_percentile(hist, 99.0);
+    out->p999 = histogram_percentile(hist, 99.9);
+    out->max = histogram_percentile(hist, 100.0);
+}
+
 /**
  * @brief Calcula todas las métricas de rendimiento para un conjunto de procesos
  * después de una simulación.
@@ -22,6 +34,10 @@ void calculate_metrics(process_t *processes, int n, int total_time, metrics_t *m
         metrics->cpu_utilization = 0.0;
         metrics->throughput = 0.0;
         metrics->fairness_index = 0.0;
+        metrics->deadline_count = 0;
+        metrics->deadline_miss_ratio = 0.0;
+        metrics->max_lateness = 0.0;
+        metrics->tat_percentiles = metrics->wt_percentiles = metrics->rt_percentiles = (percentiles_t){0};
         return;
     }
 
@@ -35,6 +51,17 @@ void calculate_metrics(process_t *processes, int n, int total_time, metrics_t *m
     double sum_xi_squared = 0.0;    // Suma de xi^2
     int completed_processes = 0;
 
+    // Para deadlines
+    int deadline_count = 0;
+    int missed_deadlines = 0;
+    int max_lateness = 0;
+
+    // Para percentiles: histogramas de memoria fija, sin ordenar los procesos
+    histogram_t tat_hist, wt_hist, rt_hist;
+    histogram_init(&tat_hist);
+    histogram_init(&wt_hist);
+    histogram_init(&rt_hist);
+
     // 1. Iterar sobre todos los procesos para calcular métricas individuales y sumas
     for (int i = 0; i < n; i++) {
         // Solo considerar procesos que realmente se completaron (completion_time > 0)
@@ -63,9 +90,29 @@ void calculate_metrics(process_t *processes, int n, int total_time, metrics_t *m
             double tat = (double)processes[i].turnaround_time;
             sum_xi += tat;
             sum_xi_squared += tat * tat;
+
+            // g. Histogramas para percentiles
+            histogram_record(&tat_hist, processes[i].turnaround_time);
+            histogram_record(&wt_hist, processes[i].waiting_time);
+            histogram_record(&rt_hist, processes[i].response_time);
+
+            // h. Deadlines: lateness = Completion Time - (Arrival Time + Deadline)
+            if (processes[i].deadline > 0) {
+                int lateness = processes[i].completion_time - (processes[i].arrival_time + processes[i].deadline);
+                if (deadline_count == 0 || lateness > max_lateness) max_lateness = lateness;
+                if (lateness > 0) missed_deadlines++;
+                deadline_count++;
+            }
         }
     }
 
+    metrics->deadline_count = deadline_count;
+    metrics->deadline_miss_ratio = deadline_count > 0 ? (double)missed_deadlines / deadline_count : 0.0;
+    metrics->max_lateness = max_lateness;
+    fill_percentiles(&tat_hist, &metrics->tat_percentiles);
+    fill_percentiles(&wt_hist, &metrics->wt_percentiles);
+    fill_percentiles(&rt_hist, &metrics->rt_percentiles);
+
     // Si no se completó ningún proceso (simulación incompleta, aunque no debería pasar si total_time > 0)
     if (completed_processes == 0) {
         metrics->avg_turnaround_time = 0.0;
@@ -96,3 +143,108 @@ void calculate_metrics(process_t *processes, int n, int total_time, metrics_t *m
         metrics->fairness_index = 0.0; // Si sum_xi_squared es 0, no hay equidad o no hay procesos.
     }
 }
+
+/**
+ * @brief Calcula las métricas globales y la utilización de cada núcleo de una
+ * simulación SMP. El tiempo ocupado de un núcleo es la suma de sus segmentos
+ * con un proceso (pid > 0); IDLE y el costo de los boosts no cuentan.
+ */
+void calculate_smp_metrics(process_t *processes, int n, int total_time,
+                           const timeline_t *timelines, int num_cpus,
+                           metrics_t *metrics, double *cpu_utilization) {
+    calculate_metrics(processes, n, total_time, metrics);
+
+    double total_busy = 0.0;
+    for (int c = 0; c < num_cpus; c++) {
+        long long busy = 0;
+        for (int i = 0; i < timelines[c].count && timelines[c].events[i].pid != 0; i++) {
+            if (timelines[c].events[i].pid > 0) {
+                busy += timelines[c].events[i].duration;
+            }
+        }
+        cpu_utilization[c] = total_time > 0 ? (double)busy / total_time * 100.0 : 0.0;
+        total_busy += busy;
+    }
+
+    // Utilización agregada: tiempo ocupado de todas las CPUs sobre la capacidad total
+    if (total_time > 0 && num_cpus > 0) {
+        metrics->cpu_utilization = total_busy / ((double)total_time * num_cpus) * 100.0;
+    }
+}
+
+// --- Acumulador Incremental ---
+
+void metrics_acc_reset(metrics_acc_t *acc) {
+    acc->completed = 0;
+    acc->max_completion = 0;
+    acc->sum_tat = acc->sum_wt = acc->sum_rt = acc->sum_burst = 0;
+    acc->sum_tat_squared = 0.0L;
+    acc->deadline_count = 0;
+    acc->missed_deadlines = 0;
+    acc->max_lateness = 0;
+    histogram_init(&acc->tat_hist);
+    histogram_init(&acc->wt_hist);
+    histogram_init(&acc->rt_hist);
+}
+
+/**
+ * @brief Mismas fórmulas (y mismo filtro completion_time > 0) que calculate_metrics.
+ * Las sumas lineales son long long, exactas para cualquier número de procesos
+ * int. La suma de cuadrados pasa de 2^53 (el límite exacto de double) con
+ * 10^7-10^8 procesos y puede pasar de 2^63, así que usa long double: con la
+ * mantisa de 64 bits de x86 sigue siendo exacta hasta 2^64.
+ */
+void metrics_acc_add(metrics_acc_t *acc, int arrival, int burst, int start, int completion, int deadline) {
+    if (completion <= 0) return;
+
+    int tat = completion - arrival;
+    int wt = tat - burst;
+    int rt = start - arrival;
+
+    acc->completed++;
+    if (completion > acc->max_completion) acc->max_completion = completion;
+    acc->sum_tat += tat;
+    acc->sum_wt += wt;
+    acc->sum_rt += rt;
+    acc->sum_burst += burst;
+    acc->sum_tat_squared += (long double)tat * tat;
+
+    histogram_record(&acc->tat_hist, tat);
+    histogram_record(&acc->wt_hist, wt);
+    histogram_record(&acc->rt_hist, rt);
+
+    if (deadline > 0) {
+        int lateness = completion - (arrival + deadline);
+        if (acc->deadline_count == 0 || lateness > acc->max_lateness) acc->max_lateness = lateness;
+        if (lateness > 0) acc->missed_deadlines++;
+        acc->deadline_count++;
+    }
+}
+
+int metrics_acc_finish(const metrics_acc_t *acc, metrics_t *metrics) {
+    int total_time = acc->max_completion;
+    if (acc->completed == 0 || total_time == 0) {
+        calculate_metrics(NULL, 0, 0, metrics); // Todo a 0
+        return total_time;
+    }
+
+    int completed = acc->completed;
+    metrics->avg_turnaround_time = (double)acc->sum_tat / completed;
+    metrics->avg_waiting_time = (double)acc->sum_wt / completed;
+    metrics->avg_response_time = (double)acc->sum_rt / completed;
+    metrics->cpu_utilization = ((double)acc->sum_burst / total_time) * 100.0;
+    metrics->throughput = (double)completed / (double)total_time;
+    metrics->fairness_index = acc->sum_tat_squared > 0
+        ? (double)((long double)acc->sum_tat * acc->sum_tat / (completed * acc->sum_tat_squared))
+        : 0.0;
+
+    metrics->deadline_count = acc->deadline_count;
+    metrics->deadline_miss_ratio = acc->deadline_count > 0
+        ? (double)acc->missed_deadlines / acc->deadline_count
+        : 0.0;
+    metrics->max_lateness = acc->max_lateness;
+    fill_percentiles(&acc->tat_hist, &metrics->tat_percentiles);
+    fill_percentiles(&acc->wt_hist, &metrics->wt_percentiles);
+    fill_percentiles(&acc->rt_hist, &metrics->rt_percentiles);
+    return total_time;
+}
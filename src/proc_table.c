@@ -0,0 +1,113 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/proc_table.h"
+
+#define PROC_TABLE_COLUMNS 10
+#define PROC_TABLE_STATE_COLUMNS 5 // remaining, queue_level, quantum_used, start, completion
+
+// Las columnas int32_t de un workload binario se usan como columnas int
+_Static_assert(sizeof(int) == sizeof(int32_t), "proc_table_load_view requiere int de 32 bits");
+
+int proc_table_load(proc_table_t *table, const process_t *processes, int n) {
+    // Un solo bloque para todas las columnas: las calientes quedan al principio
+    size_t column = (size_t)(n > 0 ? n : 1);
+    int *block = malloc(PROC_TABLE_COLUMNS * column * sizeof(int));
+    if (!block) {
+        perror("Fallo en la asignación de memoria para la tabla de procesos");
+        memset(table, 0, sizeof(*table));
+        return -1;
+    }
+
+    int *arrival = block;
+    int *pid = block + 4 * column;
+    int *burst = block + 5 * column;
+    int *priority = block + 6 * column;
+    int *deadline = block + 9 * column;
+
+    table->n = n;
+    table->arrival = arrival;
+    table->remaining = block + column;
+    table->queue_level = block + 2 * column;
+    table->quantum_used = block + 3 * column;
+    table->pid = pid;
+    table->burst = burst;
+    table->priority = priority;
+    table->start = block + 7 * column;
+    table->completion = block + 8 * column;
+    table->deadline = deadline;
+    table->storage = block;
+
+    for (int i = 0; i < n; i++) {
+        arrival[i] = processes[i].arrival_time;
+        table->remaining[i] = processes[i].remaining_time;
+        table->queue_level[i] = processes[i].current_queue;
+        table->quantum_used[i] = processes[i].time_in_current_quantum;
+        pid[i] = processes[i].pid;
+        burst[i] = processes[i].burst_time;
+        priority[i] = processes[i].priority;
+        table->start[i] = processes[i].start_time;
+        table->completion[i] = processes[i].completion_time;
+        deadline[i] = processes[i].deadline;
+    }
+    return 0;
+}
+
+int proc_table_load_view(proc_table_t *table, const workload_view_t *view) {
+    // Solo las columnas de estado (y deadline si el archivo no la tiene) son propias
+    size_t column = (size_t)(view->count > 0 ? view->count : 1);
+    int columns = PROC_TABLE_STATE_COLUMNS + (view->deadline == NULL);
+    int *block = malloc(columns * column * sizeof(int));
+    if (!block) {
+        perror("Fallo en la asignación de memoria para la tabla de procesos");
+        memset(table, 0, sizeof(*table));
+        return -1;
+    }
+
+    table->n = view->count;
+    table->arrival = (const int *)view->arrival;
+    table->remaining = block;
+    table->queue_level = block + column;
+    table->quantum_used = block + 2 * column;
+    table->pid = (const int *)view->pid;
+    table->burst = (const int *)view->burst;
+    table->priority = (const int *)view->priority;
+    table->start = block + 3 * column;
+    table->completion = block + 4 * column;
+    if (view->deadline) {
+        table->deadline = (const int *)view->deadline;
+    } else {
+        int *deadline = block + 5 * column;
+        memset(deadline, 0, column * sizeof(int));
+        table->deadline = deadline;
+    }
+    table->storage = block;
+
+    proc_table_reset(table);
+    return 0;
+}
+
+void proc_table_reset(proc_table_t *table) {
+    memcpy(table->remaining, table->burst, (size_t)table->n * sizeof(int));
+    for (int i = 0; i < table->n; i++) {
+        table->queue_level[i] = 0;
+        table->quantum_used[i] = 0;
+        table->start[i] = -1;
+        table->completion[i] = 0;
+    }
+}
+
+void proc_table_store(const proc_table_t *table, process_t *processes) {
+    for (int i = 0; i < table->n; i++) {
+        processes[i].remaining_time = table->remaining[i];
+        processes[i].start_time = table->start[i];
+        processes[i].completion_time = table->completion[i];
+        processes[i].current_queue = table->queue_level[i];
+        processes[i].time_in_current_quantum = table->quantum_used[i];
+    }
+}
+
+void proc_table_free(proc_table_t *table) {
+    free(table->storage);
+    memset(table, 0, sizeof(*table));
+}
@@ -0,0 +1,235 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "../include/rbtree.h"
+
+// Implementación clásica (Cormen et al.) con un nodo centinela negro en lugar de
+// punteros nulos, lo que simplifica las rotaciones y la reparación tras eliminar.
+
+int rbtree_init(rbtree_t *tree, int capacity, rbtree_cmp_t before, const void *ctx) {
+    int nodes = (capacity > 0 ? capacity : 0) + 1; // + centinela
+    tree->left = malloc(nodes * sizeof(int));
+    tree->right = malloc(nodes * sizeof(int));
+    tree->parent = malloc(nodes * sizeof(int));
+    tree->red = malloc(nodes * sizeof(unsigned char));
+    if (!tree->left || !tree->right || !tree->parent || !tree->red) {
+        perror("Fallo en la asignación de memoria para el árbol rojo-negro");
+        rbtree_free(tree);
+        return -1;
+    }
+    tree->nil = nodes - 1;
+    tree->red[tree->nil] = 0;
+    tree->left[tree->nil] = tree->right[tree->nil] = tree->parent[tree->nil] = tree->nil;
+    tree->root = tree->nil;
+    tree->leftmost = tree->nil;
+    tree->size = 0;
+    tree->before = before;
+    tree->ctx = ctx;
+    return 0;
+}
+
+void rbtree_free(rbtree_t *tree) {
+    free(tree->left);
+    free(tree->right);
+    free(tree->parent);
+    free(tree->red);
+    tree->left = tree->right = tree->parent = NULL;
+    tree->red = NULL;
+    tree->size = 0;
+}
+
+static void rotate_left(rbtree_t *t, int x) {
+    int y = t->right[x];
+    t->right[x] = t->left[y];
+    if (t->left[y] != t->nil) t->parent[t->left[y]] = x;
+    t->parent[y] = t->parent[x];
+    if (t->parent[x] == t->nil) t->root = y;
+    else if (x == t->left[t->parent[x]]) t->left[t->parent[x]] = y;
+    else t->right[t->parent[x]] = y;
+    t->left[y] = x;
+    t->parent[x] = y;
+}
+
+static void rotate_right(rbtree_t *t, int x) {
+    int y = t->left[x];
+    t->left[x] = t->right[y];
+    if (t->right[y] != t->nil) t->parent[t->right[y]] = x;
+    t->parent[y] = t->parent[x];
+    if (t->parent[x] == t->nil) t->root = y;
+    else if (x == t->right[t->parent[x]]) t->right[t->parent[x]] = y;
+    else t->left[t->parent[x]] = y;
+    t->right[y] = x;
+    t->parent[x] = y;
+}
+
+void rbtree_insert(rbtree_t *t, int z) {
+    int y = t->nil;
+    int x = t->root;
+    int is_leftmost = 1;
+
+    // 1. Descenso de árbol binario de búsqueda
+    while (x != t->nil) {
+        y = x;
+        if (t->before(t->ctx, z, x) < 0) {
+            x = t->left[x];
+        } else {
+            x = t->right[x];
+            is_leftmost = 0;
+        }
+    }
+    t->parent[z] = y;
+    if (y == t->nil) t->root = z;
+    else if (t->before(t->ctx, z, y) < 0) t->left[y] = z;
+    else t->right[y] = z;
+    t->left[z] = t->right[z] = t->nil;
+    t->red[z] = 1;
+    if (is_leftmost) t->leftmost = z;
+    t->size++;
+
+    // 2. Restaurar las propiedades rojo-negro
+    while (t->red[t->parent[z]]) {
+        int p = t->parent[z];
+        int g = t->parent[p];
+        if (p == t->left[g]) {
+            int uncle = t->right[g];
+            if (t->red[uncle]) {
+                t->red[p] = t->red[uncle] = 0;
+                t->red[g] = 1;
+                z = g;
+            } else {
+                if (z == t->right[p]) {
+                    z = p;
+                    rotate_left(t, z);
+                    p = t->parent[z];
+                }
+                t->red[p] = 0;
+                t->red[g] = 1;
+                rotate_right(t, g);
+            }
+        } else {
+            int uncle = t->left[g];
+            if (t->red[uncle]) {
+                t->red[p] = t->red[uncle] = 0;
+                t->red[g] = 1;
+                z = g;
+            } else {
+                if (z == t->left[p]) {
+                    z = p;
+                    rotate_right(t, z);
+                    p = t->parent[z];
+                }
+                t->red[p] = 0;
+                t->red[g] = 1;
+                rotate_left(t, g);
+            }
+        }
+    }
+    t->red[t->root] = 0;
+}
+
+static void transplant(rbtree_t *t, int u, int v) {
+    if (t->parent[u] == t->nil) t->root = v;
+    else if (u == t->left[t->parent[u]]) t->left[t->parent[u]] = v;
+    else t->right[t->parent[u]] = v;
+    t->parent[v] = t->parent[u]; // También sobre el centinela: lo usa la reparación
+}
+
+static int subtree_min(const rbtree_t *t, int x) {
+    while (t->left[x] != t->nil) x = t->left[x];
+    return x;
+}
+
+void rbtree_erase(rbtree_t *t, int z) {
+    // El primero no tiene hijo izquierdo: su sucesor es el mínimo de su subárbol
+    // derecho o, si no lo tiene, su padre.
+    if (z == t->leftmost) {
+        t->leftmost = t->right[z] != t->nil ? subtree_min(t, t->right[z]) : t->parent[z];
+    }
+
+    // 1. Eliminación de árbol binario de búsqueda
+    int y = z;
+    int y_was_red = t->red[y];
+    int x;
+    if (t->left[z] == t->nil) {
+        x = t->right[z];
+        transplant(t, z, t->right[z]);
+    } else if (t->right[z] == t->nil) {
+        x = t->left[z];
+        transplant(t, z, t->left[z]);
+    } else {
+        y = subtree_min(t, t->right[z]);
+        y_was_red = t->red[y];
+        x = t->right[y];
+        if (t->parent[y] == z) {
+            t->parent[x] = y;
+        } else {
+            transplant(t, y, t->right[y]);
+            t->right[y] = t->right[z];
+            t->parent[t->right[y]] = y;
+        }
+        transplant(t, z, y);
+        t->left[y] = t->left[z];
+        t->parent[t->left[y]] = y;
+        t->red[y] = t->red[z];
+    }
+    t->size--;
+    if (y_was_red) return;
+
+    // 2. Restaurar las propiedades rojo-negro (x lleva un negro extra)
+    while (x != t->root && !t->red[x]) {
+        int p = t->parent[x];
+        if (x == t->left[p]) {
+            int w = t->right[p];
+            if (t->red[w]) {
+                t->red[w] = 0;
+                t->red[p] = 1;
+                rotate_left(t, p);
+                w = t->right[p];
+            }
+            if (!t->red[t->left[w]] && !t->red[t->right[w]]) {
+                t->red[w] = 1;
+                x = p;
+            } else {
+                if (!t->red[t->right[w]]) {
+                    t->red[t->left[w]] = 0;
+                    t->red[w] = 1;
+                    rotate_right(t, w);
+                    w = t->right[p];
+                }
+                t->red[w] = t->red[p];
+                t->red[p] = 0;
+                t->red[t->right[w]] = 0;
+                rotate_left(t, p);
+                x = t->root;
+            }
+        } else {
+            int w = t->left[p];
+            if (t->red[w]) {
+                t->red[w] = 0;
+                t->red[p] = 1;
+                rotate_right(t, p);
+                w = t->left[p];
+            }
+            if (!t->red[t->right[w]] && !t->red[t->left[w]]) {
+                t->red[w] = 1;
+                x = p;
+            } else {
+                if (!t->red[t->left[w]]) {
+                    t->red[t->right[w]] = 0;
+                    t->red[w] = 1;
+                    rotate_left(t, w);
+                    w = t->left[p];
+                }
+                t->red[w] = t->red[p];
+                t->red[p] = 0;
+                t->red[t->left[w]] = 0;
+                rotate_right(t, p);
+                x = t->root;
+            }
+        }
+    }
+    t->red[x] = 0;
+}
+
+int rbtree_first(const rbtree_t *tree) {
+    return tree->leftmost != tree->nil ? tree->leftmost : -1;
+}
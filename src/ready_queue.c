@@ -0,0 +1,221 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "../include/ready_queue.h"
+
+int ready_queue_init(ready_queue_t *queue, int capacity, ready_queue_cmp_t before, const void *ctx) {
+    queue->heap = malloc((capacity > 0 ? capacity : 1) * sizeof(int));
+    if (!queue->heap) {
+        perror("Fallo en la asignación de memoria para la cola de listos");
+        return -1;
+    }
+    queue->size = 0;
+    queue->capacity = capacity;
+    queue->before = before;
+    queue->ctx = ctx;
+    return 0;
+}
+
+void ready_queue_free(ready_queue_t *queue) {
+    free(queue->heap);
+    queue->heap = NULL;
+    queue->size = 0;
+    queue->capacity = 0;
+}
+
+void ready_queue_push(ready_queue_t *queue, int idx) {
+    if (queue->size == queue->capacity) {
+        int new_capacity = queue->capacity > 0 ? queue->capacity * 2 : 16;
+        int *new_heap = realloc(queue->heap, (size_t)new_capacity * sizeof(int));
+        if (!new_heap) {
+            perror("Fallo al ampliar la cola de listos");
+            exit(EXIT_FAILURE);
+        }
+        queue->heap = new_heap;
+        queue->capacity = new_capacity;
+    }
+
+    int *heap = queue->heap;
+    int child = queue->size++;
+
+    // Subir el nuevo elemento mientras deba ejecutarse antes que su padre
+    while (child > 0) {
+        int parent = (child - 1) / 2;
+        if (queue->before(queue->ctx, idx, heap[parent]) >= 0) break;
+        heap[child] = heap[parent];
+        child = parent;
+    }
+    heap[child] = idx;
+}
+
+int ready_queue_pop(ready_queue_t *queue) {
+    if (queue->size == 0) return -1;
+
+    int *heap = queue->heap;
+    int top = heap[0];
+    int last = heap[--queue->size];
+    int parent = 0;
+
+    // Bajar el último elemento desde la raíz hasta su posición
+    for (;;) {
+        int child = 2 * parent + 1;
+        if (child >= queue->size) break;
+        if (child + 1 < queue->size && queue->before(queue->ctx, heap[child + 1], heap[child]) < 0) {
+            child++;
+        }
+        if (queue->before(queue->ctx, heap[child], last) >= 0) break;
+        heap[parent] = heap[child];
+        parent = child;
+    }
+    heap[parent] = last;
+    return top;
+}
+
+int ready_queue_peek(const ready_queue_t *queue) {
+    return queue->size > 0 ? queue->heap[0] : -1;
+}
+
+int ring_queue_init(ring_queue_t *queue, int capacity) {
+    int size = 1;
+    while (size < capacity) size <<= 1;
+
+    queue->slots = malloc(size * sizeof(int));
+    if (!queue->slots) {
+        perror("Fallo en la asignación de memoria para la cola circular");
+        return -1;
+    }
+    queue->mask = size - 1;
+    queue->head = 0;
+    queue->size = 0;
+    return 0;
+}
+
+void ring_queue_free(ring_queue_t *queue) {
+    free(queue->slots);
+    queue->slots = NULL;
+    queue->mask = 0;
+    queue->head = 0;
+    queue->size = 0;
+}
+
+int ring_queue_grow(ring_queue_t *queue, int capacity) {
+    if (capacity <= queue->mask + 1) return 0;
+    int size = 1;
+    while (size < capacity) size <<= 1;
+
+    int *slots = malloc(size * sizeof(int));
+    if (!slots) {
+        perror("Fallo al ampliar la cola circular");
+        return -1;
+    }
+    for (int i = 0; i < queue->size; i++) {
+        slots[i] = queue->slots[(queue->head + i) & queue->mask];
+    }
+    free(queue->slots);
+    queue->slots = slots;
+    queue->mask = size - 1;
+    queue->head = 0;
+    return 0;
+}
+
+void ring_queue_push(ring_queue_t *queue, int idx) {
+    queue->slots[(queue->head + queue->size++) & queue->mask] = idx;
+}
+
+int ring_queue_pop(ring_queue_t *queue) {
+    if (queue->size == 0) return -1;
+
+    int idx = queue->slots[queue->head];
+    queue->head = (queue->head + 1) & queue->mask;
+    queue->size--;
+    return idx;
+}
+
+void level_queue_init(level_queue_t *queue, int *next) {
+    queue->next = next;
+    queue->bitmap = 0;
+}
+
+void level_queue_push(level_queue_t *queue, int level, int idx) {
+    queue->next[idx] = -1;
+    if (queue->bitmap & (1ULL << level)) {
+        queue->next[queue->tail[level]] = idx;
+    } else {
+        queue->head[level] = idx;
+        queue->bitmap |= 1ULL << level;
+    }
+    queue->tail[level] = idx;
+}
+
+int level_queue_pop(level_queue_t *queue) {
+    if (!queue->bitmap) return -1;
+
+    int level = __builtin_ctzll(queue->bitmap);
+    int idx = queue->head[level];
+    queue->head[level] = queue->next[idx];
+    if (queue->head[level] == -1) {
+        queue->bitmap &= ~(1ULL << level);
+    }
+    return idx;
+}
+
+int level_queue_boost(level_queue_t *queue) {
+    unsigned long long lower = queue->bitmap & ~1ULL;
+    if (!lower) return 0;
+
+    int level;
+    if (!(queue->bitmap & 1ULL)) {
+        // Q0 vacía: la primera cola no vacía pasa a ser Q0
+        level = __builtin_ctzll(lower);
+        lower &= lower - 1;
+        queue->head[0] = queue->head[level];
+        queue->tail[0] = queue->tail[level];
+    }
+    while (lower) {
+        level = __builtin_ctzll(lower);
+        lower &= lower - 1;
+        queue->next[queue->tail[0]] = queue->head[level];
+        queue->tail[0] = queue->tail[level];
+    }
+    queue->bitmap = 1ULL;
+    return 1;
+}
+
+int ticket_tree_init(ticket_tree_t *tree, int capacity) {
+    int size = capacity > 0 ? capacity : 0;
+    tree->sum = calloc((size_t)size + 1, sizeof(long long));
+    if (!tree->sum) {
+        perror("Fallo en la asignación de memoria para el árbol de tickets");
+        return -1;
+    }
+    tree->size = size;
+    tree->top = 1;
+    while (tree->top * 2 <= size) tree->top *= 2;
+    tree->total = 0;
+    return 0;
+}
+
+void ticket_tree_free(ticket_tree_t *tree) {
+    free(tree->sum);
+    tree->sum = NULL;
+    tree->size = 0;
+    tree->total = 0;
+}
+
+void ticket_tree_add(ticket_tree_t *tree, int idx, long long delta) {
+    for (int i = idx + 1; i <= tree->size; i += i & -i) {
+        tree->sum[i] += delta;
+    }
+    tree->total += delta;
+}
+
+int ticket_tree_find(const ticket_tree_t *tree, long long ticket) {
+    // Descenso binario: pos acumula el prefijo más largo cuya suma no supera ticket
+    int pos = 0;
+    for (int step = tree->top; step > 0; step >>= 1) {
+        if (pos + step <= tree->size && tree->sum[pos + step] <= ticket) {
+            pos += step;
+            ticket -= tree->sum[pos];
+        }
+    }
+    return pos; // Índice 0-based del proceso pos + 1
+}
@@ -1,9 +1,13 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stddef.h>
+#include <pthread.h>
 #include "../include/scheduler.h"
 #include "../include/algorithms.h"
 #include "../include/metrics.h"
+#include "../include/buffers.h"
+#include "../include/report.h"
 
 // Estructura auxiliar para almacenar los resultados de la comparación
 typedef struct {
@@ -12,9 +16,40 @@ typedef struct {
     int total_time;
 } algorithm_result_t;
 
+// Número de algoritmos que compara el informe (ver run_all_algorithms)
+#define NUM_REPORT_ALGORITHMS 11
+
 // --- Prototipo de la función auxiliar ---
 void run_all_algorithms(process_t *original_processes, int n, algorithm_result_t *results, int num_algorithms);
 
+/**
+ * @brief Escribe la tabla de percentiles de una métrica (TAT, WT o RT) para todos los algoritmos.
+ * @param offset Posición del percentiles_t dentro de metrics_t.
+ */
+static void write_percentile_table(FILE *file, const char *metric, const algorithm_result_t *results,
+                                   int num_algorithms, size_t offset) {
+    fprintf(file, "### %s\n", metric);
+    fprintf(file, "| Algorithm | P50     | P90     | P99     | P99.9   | Max     |\n");
+    fprintf(file, "|-----------|---------|---------|---------|---------|---------|\n");
+    for (int i = 0; i < num_algorithms; i++) {
+        const percentiles_t *pct = (const percentiles_t *)((const char *)&results[i].metrics + offset);
+        fprintf(file, "| %-9s | %-7d | %-7d | %-7d | %-7d | %-7d |\n",
+                results[i].name, pct->p50, pct->p90, pct->p99, pct->p999, pct->max);
+    }
+    fprintf(file, "\n");
+}
+
+/**
+ * @brief Busca el resultado de un algoritmo por su nombre.
+ * @return Puntero al resultado, o NULL si no está.
+ */
+static const algorithm_result_t *find_result(const algorithm_result_t *results, int num_algorithms, const char *name) {
+    for (int i = 0; i < num_algorithms; i++) {
+        if (strcmp(results[i].name, name) == 0) return &results[i];
+    }
+    return NULL;
+}
+
 /**
  * @brief Genera un informe de rendimiento en formato Markdown.
  * @param filename Nombre del archivo de salida (ej: "report.md").
@@ -28,17 +63,9 @@ void generate_report(const char *filename, process_t *original_processes, int n)
         return;
     }
 
-    // Array para almacenar los resultados de 5 algoritmos
-    algorithm_result_t results[5];
-    int num_algorithms = 5;
-    
-    // Configuración para MLFQ (Ejemplo)
-    int mlfq_quantums[] = {2, 4, 8};
-    mlfq_config_t mlfq_config = {
-        .num_queues = 3,
-        .quantums = mlfq_quantums,
-        .boost_interval = 10
-    };
+    // Array para almacenar los resultados de todos los algoritmos
+    algorithm_result_t results[NUM_REPORT_ALGORITHMS];
+    int num_algorithms = NUM_REPORT_ALGORITHMS;
 
     // 1. Ejecutar y recopilar resultados de todos los algoritmos
     run_all_algorithms(original_processes, n, results, num_algorithms);
@@ -87,6 +114,38 @@ void generate_report(const char *filename, process_t *original_processes, int n)
     }
     fprintf(file, "\n");
 
+    // --- Sección de Latencia de Cola ---
+    fprintf(file, "## Latencia de Cola (Percentiles)\n");
+    write_percentile_table(file, "Turnaround Time (TAT)", results, num_algorithms, offsetof(metrics_t, tat_percentiles));
+    write_percentile_table(file, "Waiting Time (WT)", results, num_algorithms, offsetof(metrics_t, wt_percentiles));
+    write_percentile_table(file, "Response Time (RT)", results, num_algorithms, offsetof(metrics_t, rt_percentiles));
+
+    // --- Sección de Deadlines (solo si el workload los define) ---
+    if (num_algorithms > 0 && results[0].metrics.deadline_count > 0) {
+        fprintf(file, "## Deadlines (%d procesos con deadline)\n", results[0].metrics.deadline_count);
+        fprintf(file, "| Algorithm | Miss Rate | Max Lateness |\n");
+        fprintf(file, "|-----------|-----------|--------------|\n");
+        for (int i = 0; i < num_algorithms; i++) {
+            fprintf(file, "| %-9s | %8.2f%% | %-12.0f |\n",
+                    results[i].name,
+                    results[i].metrics.deadline_miss_ratio * 100.0,
+                    results[i].metrics.max_lateness);
+        }
+        fprintf(file, "\n");
+
+        const algorithm_result_t *edf = find_result(results, num_algorithms, "EDF");
+        const algorithm_result_t *stcf = find_result(results, num_algorithms, "STCF");
+        const algorithm_result_t *rr = find_result(results, num_algorithms, "RR (q=3)");
+        if (edf && stcf && rr) {
+            fprintf(file, "Deadlines incumplidos: **EDF** %.2f%% frente a **STCF** %.2f%% y **RR** %.2f%% "
+                          "(retraso máximo: %.0f / %.0f / %.0f).\n\n",
+                    edf->metrics.deadline_miss_ratio * 100.0,
+                    stcf->metrics.deadline_miss_ratio * 100.0,
+                    rr->metrics.deadline_miss_ratio * 100.0,
+                    edf->metrics.max_lateness, stcf->metrics.max_lateness, rr->metrics.max_lateness);
+        }
+    }
+
     // --- Sección de Análisis ---
     fprintf(file, "## Análisis y Recomendaciones\n");
     fprintf(file, "El algoritmo con el **menor tiempo de retorno promedio (Avg TAT)** para esta carga de trabajo fue **%s** (%.2f unidades de tiempo).\n\n", best_alg, min_tat);
@@ -94,75 +153,138 @@ void generate_report(const char *filename, process_t *original_processes, int n)
     fprintf(file, "### Conclusiones Clave\n");
     fprintf(file, "* **Para trabajos de Lote (Batch Jobs):** Algoritmos como **SJF** o **STCF** suelen ser óptimos para minimizar el TAT y el WT.\n");
     fprintf(file, "* **Para sistemas Interactivos:** **Round Robin (RR)** o **MLFQ** son preferibles debido a su bajo **Tiempo de Respuesta (Avg RT)**.\n");
+    fprintf(file, "* **Equidad ponderada:** **CFS** reparte la CPU en proporción al peso de cada proceso (su prioridad), sin quantums fijos.\n");
+    fprintf(file, "* **Reparto proporcional:** **Stride** y **Lottery** asignan quantums según los tickets de cada proceso (derivados de su prioridad): de forma determinista o por sorteo.\n");
+    fprintf(file, "* **Prioridades (NP / P):** atienden primero la menor prioridad numérica; el aging (un nivel cada 5 unidades de espera) evita la inanición de los procesos de baja prioridad.\n");
+    fprintf(file, "* **Tiempo real:** **EDF** ejecuta siempre el deadline más cercano: en una CPU, si existe una planificación que cumple todos los deadlines, EDF también los cumple.\n");
     fprintf(file, "* **Equidad (Fairness Index):** RR y MLFQ suelen tener mejores índices de equidad al garantizar que ningún proceso espere indefinidamente (a menos que haya un problema de inanición).\n");
 
     fclose(file);
     printf("✅ Informe de rendimiento generado en: %s\n", filename);
 }
 
+typedef enum {
+    ALG_BASIC,                  // Sin parámetros: FIFO, SJF, STCF, EDF
+    ALG_RR,
+    ALG_MLFQ,
+    ALG_CFS,
+    ALG_STRIDE,
+    ALG_LOTTERY,
+    ALG_PRIORITY
+} algorithm_kind_t;
+
+/**
+ * @brief Trabajo de un hilo de run_all_algorithms: un algoritmo con buffers privados.
+ */
+typedef struct {
+    const char *name;
+    algorithm_kind_t kind;
+    void (*scheduler)(process_t *, int, timeline_t *); // Solo ALG_BASIC
+    int quantum;                        // Quantum para RR, stride y lotería
+    unsigned int seed;                  // Semilla para lotería
+    mlfq_config_t *mlfq_config;         // Configuración para MLFQ (solo lectura)
+    cfs_config_t *cfs_config;           // Configuración para CFS (solo lectura)
+    priority_config_t *priority_config; // Configuración para prioridades (solo lectura)
+    process_t *original_processes;      // Workload compartido (solo lectura)
+    int n;
+    algorithm_result_t *result;         // Destino exclusivo de este hilo
+} algorithm_job_t;
+
+/**
+ * @brief Ejecuta un algoritmo sobre una copia privada del workload y calcula sus métricas.
+ * Los planificadores son reentrantes (sin estado estático compartido), así que
+ * varios trabajos pueden correr en paralelo.
+ */
+static void *run_algorithm_job(void *arg) {
+    algorithm_job_t *job = arg;
+    int n = job->n;
+
+    // A. Buffers privados: copia limpia de los procesos y línea de tiempo propia,
+    // con su acumulador de métricas (el planificador lo llena al completar procesos)
+    process_set_t current;
+    timeline_t timeline;
+    metrics_acc_t acc;
+    process_set_init(&current);
+    timeline_init(&timeline);
+    timeline.stats = &acc;
+    process_set_reset(&current, job->original_processes, n);
+    process_t *current_processes = current.items;
+
+    // B. Ejecutar el planificador
+    switch (job->kind) {
+        case ALG_BASIC: job->scheduler(current_processes, n, &timeline); break;
+        case ALG_RR: schedule_rr(current_processes, n, job->quantum, &timeline); break;
+        case ALG_MLFQ: schedule_mlfq(current_processes, n, job->mlfq_config, &timeline); break;
+        case ALG_CFS: schedule_cfs(current_processes, n, job->cfs_config, &timeline); break;
+        case ALG_STRIDE: schedule_stride(current_processes, n, job->quantum, &timeline); break;
+        case ALG_LOTTERY: schedule_lottery(current_processes, n, job->quantum, job->seed, &timeline); break;
+        case ALG_PRIORITY: schedule_priority(current_processes, n, job->priority_config, &timeline); break;
+    }
+
+    // C. Métricas y tiempo total desde el acumulador, sin recorrer los procesos
+    int total_time = metrics_acc_finish(&acc, &job->result->metrics);
+    snprintf(job->result->name, sizeof(job->result->name), "%s", job->name);
+    job->result->total_time = total_time;
+
+    timeline_free(&timeline);
+    process_set_free(&current);
+    return NULL;
+}
+
 /**
  * @brief Función auxiliar que ejecuta todos los planificadores para la comparación.
+ * Cada algoritmo corre en su propio hilo con buffers privados; se esperan todos
+ * (join) antes de devolver, por lo que el tiempo total se aproxima al del algoritmo más lento.
  */
 void run_all_algorithms(process_t *original_processes, int n, algorithm_result_t *results, int num_algorithms) {
-    
-    // Arrays de trabajo para cada simulación
-    process_t current_processes[MAX_PROCESSES];
-    timeline_event_t timeline[MAX_TIMELINE_EVENTS];
 
-    // Configuración MLFQ (copia local para los nombres de los quantums)
-    int mlfq_quantums[] = {2, 4, 8};
+    // Configuraciones (compartidas en solo lectura por los hilos)
     mlfq_config_t mlfq_config = {
         .num_queues = 3,
-        .quantums = mlfq_quantums,
+        .quantums = {2, 4, 8}, // Q0=2, Q1=4, Q2=8
         .boost_interval = 10
     };
+    cfs_config_t cfs_config = {
+        .target_latency = 6,
+        .min_granularity = 1
+    };
+    priority_config_t priority_np_config = {.preemptive = 0, .aging_interval = 5};
+    priority_config_t priority_p_config = {.preemptive = 1, .aging_interval = 5};
     
     // Definiciones de algoritmos a ejecutar
-    struct {
-        const char *name;
-        void (*scheduler)(process_t*, int, ...); // Puntero de función genérico
-        int param; // Quantum para RR
-    } alg_defs[] = {
-        {"FIFO", (void (*)(process_t*, int, ...))schedule_fifo, 0},
-        // Nota: SJF usa el mismo prototipo que FIFO/STCF si el planificador lo maneja internamente
-        {"SJF", (void (*)(process_t*, int, ...))schedule_sjf, 0}, 
-        {"STCF", (void (*)(process_t*, int, ...))schedule_stcf, 0},
-        {"RR (q=3)", (void (*)(process_t*, int, ...))schedule_rr, 3}, // Usar quantum=3
-        {"MLFQ", (void (*)(process_t*, int, ...))schedule_mlfq, 0}
+    algorithm_job_t alg_defs[NUM_REPORT_ALGORITHMS] = {
+        {.name = "FIFO", .kind = ALG_BASIC, .scheduler = schedule_fifo},
+        {.name = "SJF", .kind = ALG_BASIC, .scheduler = schedule_sjf},
+        {.name = "STCF", .kind = ALG_BASIC, .scheduler = schedule_stcf},
+        {.name = "EDF", .kind = ALG_BASIC, .scheduler = schedule_edf},
+        {.name = "Priority NP", .kind = ALG_PRIORITY, .priority_config = &priority_np_config},
+        {.name = "Priority P", .kind = ALG_PRIORITY, .priority_config = &priority_p_config},
+        {.name = "RR (q=3)", .kind = ALG_RR, .quantum = 3}, // Usar quantum=3
+        {.name = "MLFQ", .kind = ALG_MLFQ, .mlfq_config = &mlfq_config},
+        {.name = "CFS", .kind = ALG_CFS, .cfs_config = &cfs_config},
+        {.name = "Stride (q=1)", .kind = ALG_STRIDE, .quantum = 1},
+        {.name = "Lottery (q=1)", .kind = ALG_LOTTERY, .quantum = 1, .seed = 42} // Semilla fija: informe reproducible
     };
-    
-    // La función `reset_processes` debe estar disponible (incluida/definida)
-    extern void reset_processes(process_t *processes, int n, process_t *original);
+    if (num_algorithms > NUM_REPORT_ALGORITHMS) num_algorithms = NUM_REPORT_ALGORITHMS;
 
+    pthread_t threads[NUM_REPORT_ALGORITHMS];
+    int started[NUM_REPORT_ALGORITHMS];
+
+    // 1. Lanzar un hilo por algoritmo (si no se puede crear, se ejecuta en este hilo)
     for (int i = 0; i < num_algorithms; i++) {
-        // A. Resetear y cargar procesos
-        reset_processes(current_processes, n, original_processes);
-        memset(timeline, 0, sizeof(timeline));
-        
-        // B. Ejecutar el planificador
-        if (strcmp(alg_defs[i].name, "FIFO") == 0 || strcmp(alg_defs[i].name, "SJF") == 0 || strcmp(alg_defs[i].name, "STCF") == 0) {
-            alg_defs[i].scheduler(current_processes, n, timeline);
-        } else if (strstr(alg_defs[i].name, "RR") != NULL) {
-            schedule_rr(current_processes, n, alg_defs[i].param, timeline);
-        } else if (strcmp(alg_defs[i].name, "MLFQ") == 0) {
-            schedule_mlfq(current_processes, n, &mlfq_config, timeline);
-        }
-        
-        // C. Calcular el tiempo total de simulación
-        int total_time = 0;
-        for (int j = 0; j < n; j++) {
-            if (current_processes[j].completion_time > total_time) {
-                total_time = current_processes[j].completion_time;
-            }
+        alg_defs[i].original_processes = original_processes;
+        alg_defs[i].n = n;
+        alg_defs[i].result = &results[i];
+        started[i] = pthread_create(&threads[i], NULL, run_algorithm_job, &alg_defs[i]) == 0;
+        if (!started[i]) {
+            run_algorithm_job(&alg_defs[i]);
         }
+    }
 
-        // D. Calcular métricas
-        metrics_t metrics;
-        calculate_metrics(current_processes, n, total_time, &metrics);
-
-        // E. Almacenar resultados
-        strcpy(results[i].name, alg_defs[i].name);
-        results[i].metrics = metrics;
-        results[i].total_time = total_time;
+    // 2. Esperar a todos antes de la clasificación
+    for (int i = 0; i < num_algorithms; i++) {
+        if (started[i]) {
+            pthread_join(threads[i], NULL);
+        }
     }
 }
@@ -1,75 +1,147 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <strings.h>
+#include <time.h>
 #include "../include/scheduler.h"
 #include "../include/algorithms.h" // Prototipos de schedule_fifo, schedule_stcf, etc.
 #include "../include/metrics.h"    // Prototipo de calculate_metrics
+#include "../include/buffers.h"    // process_set_t, timeline_t y reset_processes
+#include "../include/workload.h"   // load_workload
+#include "../include/report.h"     // generate_report
+#include "../include/sweep.h"      // Barrido paralelo de configuraciones RR/MLFQ
+#include "../include/smp.h"        // Simulación multiprocesador
+#include "../include/compact_timeline.h" // Gantt fusionado y codificado para imprimir
+#include "../include/trace_export.h"   // Exportación a Chrome trace / Perfetto
+#include "../include/workload_gen.h"   // Workloads sintéticos
+#include "../include/stream_sim.h"     // Simulación en streaming (sin materializar el workload)
 
 // --- Prototipos locales ---
 void print_results(const char *alg_name, process_t *processes, int n, const metrics_t *metrics);
-void print_timeline(timeline_event_t *timeline);
-void reset_processes(process_t *processes, int n, process_t *original);
+void print_metrics(const metrics_t *metrics);
+void print_timeline(const compact_timeline_t *timeline);
+int run_sweep_command(int argc, char **argv);
+int run_smp_command(int argc, char **argv);
+int run_generate_command(int argc, char **argv);
+int run_mapped_workload(const char *filename);
 
 // Workload 1: Simple (3 procesos) para ejemplo inicial
 process_t workload_1[] = {
-    {1, 0, 5, 1, 0, 0, 0, 0, 0, 0, 0, 0}, // PID 1, Arrivo 0, Burst 5, Prioridad 1
-    {2, 1, 3, 2, 0, 0, 0, 0, 0, 0, 0, 0}, // PID 2, Arrivo 1, Burst 3, Prioridad 2
-    {3, 2, 8, 1, 0, 0, 0, 0, 0, 0, 0, 0}  // PID 3, Arrivo 2, Burst 8, Prioridad 1
+    {1, 0, 5, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // PID 1, Arrivo 0, Burst 5, Prioridad 1
+    {2, 1, 3, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // PID 2, Arrivo 1, Burst 3, Prioridad 2
+    {3, 2, 8, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0}  // PID 3, Arrivo 2, Burst 8, Prioridad 1
 };
 int num_processes = 3;
 
 
-int main() {
+int main(int argc, char **argv) {
     printf("==========================================\n");
     printf("  CPU Scheduler Simulator (CLI Version) \n");
     printf("==========================================\n");
 
+    // Uso: scheduler_simulator_cli --convert workload.txt workload.bin
+    // Convierte un workload CSV al formato binario columnar y termina.
+    if (argc > 1 && strcmp(argv[1], "--convert") == 0) {
+        if (argc != 4) {
+            fprintf(stderr, "Uso: %s --convert <workload.txt> <workload.bin>\n", argv[0]);
+            return 1;
+        }
+        if (convert_workload(argv[2], argv[3]) != 0) return 1;
+        printf("✅ Workload convertido: %s -> %s\n", argv[2], argv[3]);
+        return 0;
+    }
+
+    // Uso: scheduler_simulator_cli --sweep [opciones] [workload]
+    if (argc > 1 && strcmp(argv[1], "--sweep") == 0) {
+        return run_sweep_command(argc, argv);
+    }
+
+    // Uso: scheduler_simulator_cli --smp <cpus> [opciones] [workload]
+    if (argc > 2 && strcmp(argv[1], "--smp") == 0) {
+        return run_smp_command(argc, argv);
+    }
+
+    // Uso: scheduler_simulator_cli --generate <procesos> [opciones]
+    if (argc > 2 && strcmp(argv[1], "--generate") == 0) {
+        return run_generate_command(argc, argv);
+    }
+
+    // Uso: scheduler_simulator_cli [--report report.md] [workload.txt|workload.bin]
+    // Con --report se genera el informe comparativo de todos los algoritmos.
+    const char *report_filename = NULL;
+    if (argc > 2 && strcmp(argv[1], "--report") == 0) {
+        report_filename = argv[2];
+        argv += 2;
+        argc -= 2;
+    }
+
+    // Un workload binario se simula sobre el archivo mapeado, sin copiar sus columnas
+    if (!report_filename && argc > 1 && workload_is_bin(argv[1])) {
+        return run_mapped_workload(argv[1]);
+    }
+
     // Copia de los procesos originales para que cada simulación use datos limpios
-    process_t original_processes[MAX_PROCESSES];
-    memcpy(original_processes, workload_1, num_processes * sizeof(process_t));
+    // (por defecto, el Workload 1)
+    process_set_t original;
+    process_set_init(&original);
+    if (argc > 1) {
+        if (load_workload(argv[1], &original) != 0) {
+            process_set_free(&original);
+            return 1;
+        }
+        num_processes = original.count;
+        printf("Workload cargado: %s (%d procesos)\n", argv[1], num_processes);
+    } else {
+        for (int i = 0; i < num_processes; i++) {
+            process_set_append(&original, &workload_1[i]);
+        }
+    }
+    process_t *original_processes = original.items;
+
+    if (report_filename) {
+        generate_report(report_filename, original_processes, num_processes);
+        process_set_free(&original);
+        return 0;
+    }
 
-    // Array para almacenar los procesos durante la simulación y sus resultados
-    process_t current_processes[MAX_PROCESSES];
-    // Array para almacenar la línea de tiempo (Gráfico de Gantt)
-    timeline_event_t timeline[MAX_TIMELINE_EVENTS];
+    // Conjunto de procesos durante la simulación y sus resultados
+    process_set_t current;
+    process_set_init(&current);
+    process_set_reserve(&current, num_processes);
+    process_t *current_processes = current.items;
+    // Línea de tiempo (Gráfico de Gantt), crece según la necesidad
+    timeline_t timeline;
+    compact_timeline_t gantt; // Versión compacta para imprimir
+    metrics_acc_t acc; // El planificador registra ahí cada proceso terminado
+    timeline_init(&timeline);
+    compact_timeline_init(&gantt);
+    timeline.stats = &acc;
     // Estructura para almacenar las métricas
     metrics_t metrics;
     int total_time = 0; // Tiempo total de la simulación
 
-    // --- Configuración MLFQ de ejemplo ---
-    int mlfq_quantums[] = {2, 4, 8}; // Quantum para Q0, Q1, Q2
-    mlfq_config_t mlfq_config = {
-        .num_queues = 3,
-        .quantums = mlfq_quantums,
-        .boost_interval = 10
-    };
-
     // ------------------------------------
     // 1. Simular FIFO
     // ------------------------------------
     printf("\n--- Simulación: FIFO ---\n");
     reset_processes(current_processes, num_processes, original_processes);
-    schedule_fifo(current_processes, num_processes, timeline);
+    schedule_fifo(current_processes, num_processes, &timeline);
+
+    // Tiempo total de simulación: la finalización del último proceso (del acumulador)
+    total_time = acc.max_completion;
 
-    // Calcular el tiempo total de simulación
-    // Se asume que el tiempo total es la finalización del último proceso
-    total_time = 0;
-    for (int i = 0; i < num_processes; i++) {
-        if (current_processes[i].completion_time > total_time) {
-            total_time = current_processes[i].completion_time;
-        }
-    }
-    
     // Si la simulación terminó en IDLE, buscar el último evento
-    if (total_time == 0 && timeline[0].pid != 0) {
-        for (int i = 0; timeline[i].pid != 0; i++) {
-            total_time = timeline[i].time + timeline[i].duration;
+    if (total_time == 0 && timeline.count > 0 && timeline.events[0].pid != 0) {
+        for (int i = 0; i < timeline.count && timeline.events[i].pid != 0; i++) {
+            total_time = timeline.events[i].time + timeline.events[i].duration;
         }
     }
 
+    // calculate_metrics además llena TAT/WT/RT de cada proceso para la tabla detallada
     calculate_metrics(current_processes, num_processes, total_time, &metrics);
     print_results("FIFO", current_processes, num_processes, &metrics);
-    print_timeline(timeline);
+    compact_timeline_build(&gantt, &timeline);
+    print_timeline(&gantt);
 
 
     // ------------------------------------
@@ -77,69 +149,418 @@ int main() {
     // ------------------------------------
     printf("\n--- Simulación: STCF ---\n");
     reset_processes(current_processes, num_processes, original_processes);
-    // Nota: Necesitas la implementación de schedule_stcf en algorithms.c
-    schedule_stcf(current_processes, num_processes, timeline);
+    schedule_stcf(current_processes, num_processes, &timeline);
+
+    total_time = acc.max_completion; // Recalcular total_time para STCF (puede ser diferente)
+    calculate_metrics(current_processes, num_processes, total_time, &metrics);
+    print_results("STCF", current_processes, num_processes, &metrics);
+    compact_timeline_build(&gantt, &timeline);
+    print_timeline(&gantt);
 
-    total_time = 0; // Recalcular total_time para STCF (puede ser diferente)
-    for (int i = 0; i < num_processes; i++) {
-        if (current_processes[i].completion_time > total_time) {
-            total_time = current_processes[i].completion_time;
+    compact_timeline_free(&gantt);
+    timeline_free(&timeline);
+    process_set_free(&current);
+    process_set_free(&original);
+    return 0;
+}
+
+/**
+ * @brief Modo barrido: evalúa una rejilla de configuraciones RR y MLFQ en paralelo
+ * e imprime la tabla de métricas ordenada (mejor Avg TAT primero).
+ * Los rangos tienen la forma min:max[:step]; una dimensión con rango vacío
+ * (ej: --rr 1:0) no se barre.
+ */
+int run_sweep_command(int argc, char **argv) {
+    sweep_grid_t grid = {
+        .rr_quantum = {1, 10, 1},
+        .mlfq_queues = {2, 5, 1},
+        .mlfq_quantum = {1, 4, 1},
+        .mlfq_factor = {1, 3, 1},
+        .mlfq_boost = {10, 50, 10}
+    };
+    int num_threads = sweep_default_threads();
+    const char *workload_filename = NULL;
+    const char *out_filename = NULL;
+
+    for (int i = 2; i < argc; i++) {
+        sweep_range_t *range = NULL;
+        if (strcmp(argv[i], "--rr") == 0) range = &grid.rr_quantum;
+        else if (strcmp(argv[i], "--mlfq-queues") == 0) range = &grid.mlfq_queues;
+        else if (strcmp(argv[i], "--mlfq-quantum") == 0) range = &grid.mlfq_quantum;
+        else if (strcmp(argv[i], "--mlfq-factor") == 0) range = &grid.mlfq_factor;
+        else if (strcmp(argv[i], "--mlfq-boost") == 0) range = &grid.mlfq_boost;
+
+        if (range || strcmp(argv[i], "--threads") == 0 || strcmp(argv[i], "--out") == 0) {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "Falta el valor de %s\n", argv[i]);
+                return 1;
+            }
+            const char *option = argv[i];
+            const char *value = argv[++i];
+            if (range) {
+                if (sweep_parse_range(value, range) != 0) {
+                    fprintf(stderr, "Rango inválido para %s: %s (formato min:max[:step])\n", option, value);
+                    return 1;
+                }
+            } else if (strcmp(option, "--threads") == 0) {
+                num_threads = atoi(value);
+            } else {
+                out_filename = value;
+            }
+        } else if (!workload_filename && argv[i][0] != '-') {
+            workload_filename = argv[i];
+        } else {
+            fprintf(stderr, "Uso: %s --sweep [--rr min:max[:step]] [--mlfq-queues r] [--mlfq-quantum r]\n"
+                            "       [--mlfq-factor r] [--mlfq-boost r] [--threads N] [--out tabla.md] [workload]\n",
+                    argv[0]);
+            return 1;
         }
     }
 
-    calculate_metrics(current_processes, num_processes, total_time, &metrics);
-    print_results("STCF", current_processes, num_processes, &metrics);
-    print_timeline(timeline);
+    process_set_t original;
+    process_set_init(&original);
+    if (workload_filename) {
+        if (load_workload(workload_filename, &original) != 0) {
+            process_set_free(&original);
+            return 1;
+        }
+    } else {
+        for (int i = 0; i < num_processes; i++) {
+            process_set_append(&original, &workload_1[i]);
+        }
+    }
+
+    sweep_config_t *configs;
+    int count = sweep_expand(&grid, &configs);
+    if (count < 0) {
+        process_set_free(&original);
+        return 1;
+    }
+    sweep_result_t *results = malloc((count > 0 ? count : 1) * sizeof(sweep_result_t));
+    if (!results) {
+        perror("Fallo en la asignación de memoria para los resultados del barrido");
+        free(configs);
+        process_set_free(&original);
+        return 1;
+    }
 
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    int rc = run_sweep(original.items, original.count, configs, count, results, num_threads);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double elapsed = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
 
-    // Aquí irían las llamadas a SJF, Round Robin y MLFQ...
+    if (rc == 0) {
+        sort_sweep_results(results, count);
+        FILE *out = out_filename ? fopen(out_filename, "w") : stdout;
+        if (!out) {
+            perror("Error al abrir el archivo de salida del barrido");
+            rc = -1;
+        } else {
+            write_sweep_table(out, results, count);
+            if (out != stdout) fclose(out);
+        }
+        fprintf(stderr, "Barrido: %d configuraciones, %d procesos, %d hilos, %.3f s\n",
+                count, original.count, num_threads, elapsed);
+    }
+
+    free(results);
+    free(configs);
+    process_set_free(&original);
+    return rc == 0 ? 0 : 1;
+}
+
+/**
+ * @brief Modo SMP: simula la carga en varias CPUs con la política indicada e
+ * imprime los resultados, la utilización de cada núcleo y el Gantt de cada CPU.
+ * Con --trace escribe además la simulación como Chrome trace JSON (ver trace_export.h).
+ */
+int run_smp_command(int argc, char **argv) {
+    smp_config_t config = {
+        .num_cpus = atoi(argv[2]),
+        .policy = SMP_FIFO,
+        .quantum = 3,
+        .mlfq = {.num_queues = 3, .quantums = {2, 4, 8}, .boost_interval = 10},
+        .balance_interval = 0
+    };
+    const char *workload_filename = NULL;
+    const char *trace_filename = NULL;
 
+    for (int i = 3; i < argc; i++) {
+        if (strcmp(argv[i], "--policy") == 0 && i + 1 < argc) {
+            if (smp_parse_policy(argv[++i], &config.policy) != 0) {
+                fprintf(stderr, "Política inválida: %s (FIFO, STCF, RR o MLFQ)\n", argv[i]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--quantum") == 0 && i + 1 < argc) {
+            config.quantum = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--balance") == 0 && i + 1 < argc) {
+            config.balance_interval = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            trace_filename = argv[++i];
+        } else if (!workload_filename && argv[i][0] != '-') {
+            workload_filename = argv[i];
+        } else {
+            fprintf(stderr, "Uso: %s --smp <cpus> [--policy FIFO|STCF|RR|MLFQ] [--quantum q] "
+                            "[--balance intervalo] [--trace trace.json] [workload]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (config.num_cpus < 1) {
+        fprintf(stderr, "Número de CPUs inválido: %s\n", argv[2]);
+        return 1;
+    }
+
+    process_set_t current;
+    process_set_init(&current);
+    if (workload_filename) {
+        if (load_workload(workload_filename, &current) != 0) {
+            process_set_free(&current);
+            return 1;
+        }
+    } else {
+        for (int i = 0; i < num_processes; i++) {
+            process_set_append(&current, &workload_1[i]);
+        }
+    }
+
+    timeline_t *timelines = malloc(config.num_cpus * sizeof(timeline_t));
+    double *cpu_utilization = malloc(config.num_cpus * sizeof(double));
+    if (!timelines || !cpu_utilization) {
+        perror("Fallo en la asignación de memoria para la simulación SMP");
+        free(timelines);
+        free(cpu_utilization);
+        process_set_free(&current);
+        return 1;
+    }
+    for (int c = 0; c < config.num_cpus; c++) timeline_init(&timelines[c]);
+
+    reset_processes(current.items, current.count, current.items);
+    int rc = schedule_smp(current.items, current.count, &config, timelines);
+    if (rc == 0) {
+        int total_time = 0;
+        for (int i = 0; i < current.count; i++) {
+            if (current.items[i].completion_time > total_time) {
+                total_time = current.items[i].completion_time;
+            }
+        }
+        metrics_t metrics;
+        calculate_smp_metrics(current.items, current.count, total_time, timelines, config.num_cpus,
+                              &metrics, cpu_utilization);
+
+        char title[64];
+        snprintf(title, sizeof(title), "SMP %s (%d CPUs)", smp_policy_name(config.policy), config.num_cpus);
+        print_results(title, current.items, current.count, &metrics);
+        printf("Utilización por núcleo:\n");
+        for (int c = 0; c < config.num_cpus; c++) {
+            printf("  CPU %-3d %6.2f%%\n", c, cpu_utilization[c]);
+        }
+        compact_timeline_t gantt;
+        compact_timeline_init(&gantt);
+        for (int c = 0; c < config.num_cpus; c++) {
+            printf("\nCPU %d ", c);
+            compact_timeline_build(&gantt, &timelines[c]);
+            print_timeline(&gantt);
+        }
+        compact_timeline_free(&gantt);
+
+        if (trace_filename) {
+            if (trace_export_chrome(trace_filename, current.items, current.count, timelines, config.num_cpus) == 0) {
+                printf("\n✅ Trace exportado: %s (abrir en ui.perfetto.dev o chrome://tracing)\n", trace_filename);
+            } else {
+                rc = -1;
+            }
+        }
+    }
+
+    for (int c = 0; c < config.num_cpus; c++) timeline_free(&timelines[c]);
+    free(timelines);
+    free(cpu_utilization);
+    process_set_free(&current);
+    return rc == 0 ? 0 : 1;
+}
+
+/**
+ * @brief Modo generador: crea un workload sintético reproducible y lo escribe
+ * (--out, CSV o .bin) y/o lo simula en streaming (--stream) sin materializarlo,
+ * así que --stream admite 10^8 procesos con memoria acotada.
+ */
+int run_generate_command(int argc, char **argv) {
+    workload_gen_config_t config;
+    workload_gen_default_config(&config);
+    config.count = atoll(argv[2]);
+    const char *out_filename = NULL;
+    stream_policy_t policy = STREAM_RR;
+    int stream = 0;
+    int quantum = 4;
+
+    for (int i = 3; i < argc; i++) {
+        int valid = 1;
+        if (strcmp(argv[i], "--arrivals") == 0 && i + 1 < argc) {
+            i++;
+            if (strcasecmp(argv[i], "poisson") == 0) config.arrivals = ARRIVAL_POISSON;
+            else if (strcasecmp(argv[i], "mmpp") == 0) config.arrivals = ARRIVAL_MMPP;
+            else valid = 0;
+        } else if (strcmp(argv[i], "--bursts") == 0 && i + 1 < argc) {
+            i++;
+            if (strcasecmp(argv[i], "exponential") == 0) config.bursts = BURST_EXPONENTIAL;
+            else if (strcasecmp(argv[i], "pareto") == 0) config.bursts = BURST_PARETO;
+            else if (strcasecmp(argv[i], "bimodal") == 0) config.bursts = BURST_BIMODAL;
+            else valid = 0;
+        } else if (strcmp(argv[i], "--utilization") == 0 && i + 1 < argc) {
+            config.utilization = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--mean-burst") == 0 && i + 1 < argc) {
+            config.mean_burst = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--alpha") == 0 && i + 1 < argc) {
+            config.pareto_alpha = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--mmpp-ratio") == 0 && i + 1 < argc) {
+            config.mmpp_ratio = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--mmpp-phase") == 0 && i + 1 < argc) {
+            config.mmpp_phase = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--priorities") == 0 && i + 1 < argc) {
+            config.num_priorities = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--skew") == 0 && i + 1 < argc) {
+            config.priority_skew = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            config.seed = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+            out_filename = argv[++i];
+        } else if (strcmp(argv[i], "--stream") == 0 && i + 1 < argc) {
+            stream = 1;
+            valid = stream_parse_policy(argv[++i], &policy) == 0;
+        } else if (strcmp(argv[i], "--quantum") == 0 && i + 1 < argc) {
+            quantum = atoi(argv[++i]);
+        } else {
+            valid = 0;
+        }
+        if (!valid) {
+            fprintf(stderr, "Uso: %s --generate <procesos> [--arrivals poisson|mmpp] "
+                            "[--bursts exponential|pareto|bimodal] [--utilization u] [--mean-burst m] "
+                            "[--alpha a] [--mmpp-ratio r] [--mmpp-phase d] [--priorities k] [--skew s] "
+                            "[--seed s] [--out workload.txt|workload.bin] "
+                            "[--stream FIFO|SJF|STCF|RR] [--quantum q]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (!out_filename && !stream) {
+        fprintf(stderr, "--generate necesita --out y/o --stream\n");
+        return 1;
+    }
+
+    workload_gen_t gen;
+    if (workload_gen_init(&gen, &config) != 0) return 1;
+
+    if (out_filename) {
+        // El formato binario es columnar: se materializa; el CSV se escribe en streaming
+        const char *extension = strrchr(out_filename, '.');
+        long long written;
+        if (extension && strcmp(extension, ".bin") == 0) {
+            if (config.count > INT_MAX) {
+                fprintf(stderr, "El formato binario admite hasta %d procesos\n", INT_MAX);
+                return 1;
+            }
+            process_set_t set;
+            process_set_init(&set);
+            written = workload_gen_fill(&gen, &set);
+            if (workload_bin_write(out_filename, set.items, set.count) != 0) written = -1;
+            process_set_free(&set);
+        } else {
+            written = workload_gen_write_csv(&gen, out_filename);
+        }
+        if (written < 0) return 1;
+        printf("✅ Workload generado: %s (%lld procesos)\n", out_filename, written);
+    }
+
+    if (stream) {
+        metrics_acc_t acc;
+        metrics_t metrics;
+        stream_result_t result;
+        struct timespec t0, t1;
+        // --out pudo consumir el generador: reiniciarlo repite los mismos procesos
+        if (workload_gen_init(&gen, &config) != 0) return 1;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        if (simulate_stream(&gen, policy, quantum, &acc, &result) != 0) return 1;
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        metrics_acc_finish(&acc, &metrics);
+
+        double elapsed = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+        printf("\n--- Simulación en streaming: %s ---\n", stream_policy_name(policy));
+        printf("  - Procesos:            %lld\n", result.processes);
+        printf("  - Despachos:           %lld\n", result.dispatches);
+        printf("  - Máximo en sistema:   %d\n", result.peak_in_system);
+        printf("  - Tiempo simulado:     %d\n", result.end_time);
+        printf("  - Tiempo real:         %.2f s\n", elapsed);
+        print_metrics(&metrics);
+    }
     return 0;
 }
 
 /**
- * @brief Restablece los procesos a su estado inicial para una nueva simulación.
- * @param processes Array de trabajo para la simulación.
- * @param n Número de procesos.
- * @param original Array con el estado inicial.
+ * @brief Simula FIFO y STCF sobre un workload binario mapeado: la tabla de los
+ * planificadores lee pid, arrival, burst y priority directamente del archivo
+ * (ver proc_table_load_view), sin pasar por process_t. Como el workload puede
+ * tener millones de procesos, solo se imprimen las métricas agregadas.
  */
-void reset_processes(process_t *processes, int n, process_t *original) {
-    for (int i = 0; i < n; i++) {
-        // Copiar todos los campos base
-        processes[i] = original[i]; 
-        // Inicializar campos de simulación/resultado
-        processes[i].remaining_time = processes[i].burst_time;
-        processes[i].start_time = -1; // Usar -1 para indicar que no ha comenzado
-        processes[i].completion_time = 0;
-        processes[i].turnaround_time = 0;
-        processes[i].waiting_time = 0;
-        processes[i].response_time = 0;
-        processes[i].current_queue = 0;
-        processes[i].time_in_current_quantum = 0;
+int run_mapped_workload(const char *filename) {
+    workload_view_t view;
+    proc_table_t table;
+    if (workload_bin_open(filename, &view) != 0) return 1;
+    if (workload_bin_validate(&view, filename) != 0 || proc_table_load_view(&table, &view) != 0) {
+        workload_bin_close(&view);
+        return 1;
+    }
+    printf("Workload binario mapeado: %s (%d procesos)\n", filename, view.count);
+
+    timeline_t timeline;
+    metrics_acc_t acc; // El planificador registra ahí cada proceso terminado
+    metrics_t metrics;
+    timeline_init(&timeline);
+    timeline.stats = &acc;
+
+    const char *names[] = {"FIFO", "STCF"};
+    for (int alg = 0; alg < 2; alg++) {
+        proc_table_reset(&table);
+        if (alg == 0) schedule_fifo_table(&table, &timeline);
+        else schedule_stcf_table(&table, &timeline);
+        metrics_acc_finish(&acc, &metrics);
+
+        printf("\n--- Simulación: %s ---\n", names[alg]);
+        printf("  - Segmentos en el Gantt: %d\n", timeline.count);
+        print_metrics(&metrics);
     }
+
+    timeline_free(&timeline);
+    proc_table_free(&table);
+    workload_bin_close(&view);
+    return 0;
 }
 
 /**
- * @brief Imprime la línea de tiempo (Gantt) en la consola.
+ * @brief Imprime la línea de tiempo (Gantt) en la consola, con los segmentos
+ * contiguos de un mismo proceso ya fusionados (ver compact_timeline.h).
  */
-void print_timeline(timeline_event_t *timeline) {
+void print_timeline(const compact_timeline_t *timeline) {
     printf("  Gantt Chart (Time: [Duration] PID): \n");
     printf("  ");
     
     int current_time = 0;
-    for (int i = 0; timeline[i].pid != 0 && i < MAX_TIMELINE_EVENTS; i++) {
+    compact_timeline_iter_t iter;
+    timeline_event_t segment;
+    const timeline_event_t *event = &segment;
+    compact_timeline_iter_init(&iter, timeline);
+    while (compact_timeline_next(&iter, &segment) && event->pid != 0) {
         // Omitir eventos con duración 0
-        if (timeline[i].duration <= 0) continue; 
+        if (event->duration <= 0) continue; 
         
-        char pid_str[10];
-        if (timeline[i].pid == -1) {
+        char pid_str[16];
+        if (event->pid == -1) {
             strcpy(pid_str, "IDLE");
         } else {
-            sprintf(pid_str, "P%d", timeline[i].pid);
+            sprintf(pid_str, "P%d", event->pid);
         }
 
-        printf("%d: [%d] %s | ", timeline[i].time, timeline[i].duration, pid_str);
-        current_time = timeline[i].time + timeline[i].duration;
+        printf("%d: [%d] %s | ", event->time, event->duration, pid_str);
+        current_time = event->time + event->duration;
     }
     printf("END (%d)\n", current_time);
 }
@@ -165,7 +586,13 @@ void print_results(const char *alg_name, process_t *processes, int n, const metr
                processes[i].priority);
     }
     printf("  +-----+---------+--------+------+-----+-----+-----+-----+-----+\n");
+    print_metrics(metrics);
+}
 
+/**
+ * @brief Imprime las métricas globales y los percentiles.
+ */
+void print_metrics(const metrics_t *metrics) {
     printf("\n  Métricas de Rendimiento:\n");
     printf("  - Avg Turnaround Time: %.2f\n", metrics->avg_turnaround_time);
     printf("  - Avg Waiting Time:    %.2f\n", metrics->avg_waiting_time);
@@ -173,4 +600,20 @@ void print_results(const char *alg_name, process_t *processes, int n, const metr
     printf("  - CPU Utilization:     %.2f%%\n", metrics->cpu_utilization);
     printf("  - Throughput:          %.4f (Proc/Unit Time)\n", metrics->throughput);
     printf("  - Jain's Fairness Index: %.4f\n", metrics->fairness_index);
+    if (metrics->deadline_count > 0) {
+        printf("  - Deadline Miss Rate:  %.2f%% (%d con deadline)\n",
+               metrics->deadline_miss_ratio * 100.0, metrics->deadline_count);
+        printf("  - Max Lateness:        %.0f\n", metrics->max_lateness);
+    }
+
+    printf("\n  Percentiles:   P50     P90     P99   P99.9     Max\n");
+    const struct { const char *name; const percentiles_t *pct; } rows[] = {
+        {"TAT", &metrics->tat_percentiles},
+        {"WT", &metrics->wt_percentiles},
+        {"RT", &metrics->rt_percentiles}
+    };
+    for (int i = 0; i < 3; i++) {
+        printf("  - %-3s       %7d %7d %7d %7d %7d\n", rows[i].name,
+               rows[i].pct->p50, rows[i].pct->p90, rows[i].pct->p99, rows[i].pct->p999, rows[i].pct->max);
+    }
 }
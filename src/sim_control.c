@@ -0,0 +1,25 @@
+#include <stddef.h>
+#include "../include/sim_control.h"
+
+void sim_control_init(sim_control_t *control, void (*on_progress)(sim_control_t *), void *user_data) {
+    atomic_init(&control->cancel, 0);
+    atomic_init(&control->time, 0);
+    atomic_init(&control->completed, 0);
+    control->on_progress = on_progress;
+    control->user_data = user_data;
+    control->countdown = SIM_CONTROL_INTERVAL;
+}
+
+void sim_control_cancel(sim_control_t *control) {
+    atomic_store(&control->cancel, 1);
+}
+
+int sim_control_cancelled(sim_control_t *control) {
+    return atomic_load(&control->cancel);
+}
+
+void sim_control_publish(sim_control_t *control, int time) {
+    control->countdown = SIM_CONTROL_INTERVAL;
+    atomic_store_explicit(&control->time, time, memory_order_relaxed);
+    if (control->on_progress) control->on_progress(control);
+}
@@ -0,0 +1,425 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <strings.h>
+#include "../include/scheduler.h"
+#include "../include/buffers.h"
+#include "../include/ready_queue.h"
+#include "../include/proc_table.h"
+#include "../include/smp.h"
+
+// Simulación multiprocesador por eventos discretos. En cada instante de evento
+// (llegada, fin de tramo, boost o balanceo periódico) se procesan,
+// en este orden: finalizaciones, llegadas, procesos desalojados que vuelven a su
+// cola, desalojo por STCF, boost de MLFQ, balanceo periódico y despacho de las
+// CPUs libres (que roban trabajo si su cola está vacía). Así las llegadas entran
+// a la cola antes que el proceso desalojado en el mismo instante, igual que en
+// los algoritmos de un solo CPU.
+
+/**
+ * @brief Estado de una CPU simulada.
+ */
+typedef struct {
+    int running;                // Proceso en ejecución (-1 = libre)
+    int seg_start;              // Inicio del tramo actual del proceso en ejecución
+    int slice_end;              // Fin del tramo si nada lo interrumpe
+    int free_since;             // Desde cuándo está libre (para el segmento IDLE)
+    int queued;                 // Procesos en su cola de listos
+    int pending;                // Proceso desalojado en este instante, aún sin volver a la cola
+    level_queue_t levels;       // Cola FIFO (FIFO, RR) o colas por nivel (MLFQ)
+    ready_queue_t heap;         // Cola por remaining_time (STCF)
+} smp_cpu_t;
+
+typedef struct {
+    const smp_config_t *config;
+    proc_table_t table;
+    smp_cpu_t *cpus;
+    timeline_t *timelines;
+    int *proc_epoch;            // Época de boost de cada proceso (MLFQ perezoso)
+    int epoch;
+    int total_queued;
+} smp_state_t;
+
+const char *smp_policy_name(smp_policy_t policy) {
+    switch (policy) {
+        case SMP_FIFO: return "FIFO";
+        case SMP_STCF: return "STCF";
+        case SMP_RR: return "RR";
+        case SMP_MLFQ: return "MLFQ";
+    }
+    return "?";
+}
+
+int smp_parse_policy(const char *name, smp_policy_t *policy) {
+    for (int p = SMP_FIFO; p <= SMP_MLFQ; p++) {
+        if (strcasecmp(name, smp_policy_name((smp_policy_t)p)) == 0) {
+            *policy = (smp_policy_t)p;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Mismo criterio que STCF de un solo CPU: remaining_time, luego llegada, luego índice.
+ */
+static int compare_remaining(const void *ctx, int a, int b) {
+    const proc_table_t *table = ctx;
+    if (table->remaining[a] != table->remaining[b]) {
+        return (table->remaining[a] > table->remaining[b]) - (table->remaining[a] < table->remaining[b]);
+    }
+    if (table->arrival[a] != table->arrival[b]) {
+        return (table->arrival[a] > table->arrival[b]) - (table->arrival[a] < table->arrival[b]);
+    }
+    return (a > b) - (a < b);
+}
+
+static int cpu_load(const smp_cpu_t *cpu) {
+    return cpu->queued + (cpu->running != -1);
+}
+
+static void cpu_push(smp_state_t *st, int c, int idx) {
+    smp_cpu_t *cpu = &st->cpus[c];
+    if (st->config->policy == SMP_STCF) {
+        ready_queue_push(&cpu->heap, idx);
+    } else {
+        int level = st->config->policy == SMP_MLFQ ? st->table.queue_level[idx] : 0;
+        level_queue_push(&cpu->levels, level, idx);
+    }
+    cpu->queued++;
+    st->total_queued++;
+}
+
+/**
+ * @brief Extrae el siguiente proceso de la cola de la CPU c (-1 si está vacía).
+ */
+static int cpu_pop(smp_state_t *st, int c) {
+    smp_cpu_t *cpu = &st->cpus[c];
+    if (cpu->queued == 0) return -1;
+
+    int idx = st->config->policy == SMP_STCF ? ready_queue_pop(&cpu->heap) : level_queue_pop(&cpu->levels);
+    cpu->queued--;
+    st->total_queued--;
+    if (st->config->policy == SMP_MLFQ && st->proc_epoch[idx] != st->epoch) {
+        // Boost perezoso: hubo un boost desde la última vez que se encoló
+        st->proc_epoch[idx] = st->epoch;
+        st->table.queue_level[idx] = 0;
+        st->table.quantum_used[idx] = 0;
+    }
+    return idx;
+}
+
+/**
+ * @brief CPU con más procesos en cola (-1 si ninguna tiene procesos en espera).
+ */
+static int busiest_queue(const smp_state_t *st) {
+    int best = -1;
+    for (int c = 0; c < st->config->num_cpus; c++) {
+        if (st->cpus[c].queued > 0 && (best == -1 || st->cpus[c].queued > st->cpus[best].queued)) {
+            best = c;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Detiene el proceso en ejecución en la CPU c en el instante now.
+ * Actualiza remaining_time, el segmento del Gantt y, en RR/MLFQ, el quantum.
+ * @return El índice del proceso si debe volver a una cola, o -1 si terminó.
+ */
+static int cpu_stop(smp_state_t *st, int c, int now, int *completed) {
+    smp_cpu_t *cpu = &st->cpus[c];
+    proc_table_t *table = &st->table;
+    int idx = cpu->running;
+    int run = now - cpu->seg_start;
+    timeline_t *timeline = &st->timelines[c];
+
+    table->remaining[idx] -= run;
+    timeline->events[timeline->count - 1].duration = now - timeline->events[timeline->count - 1].time;
+    cpu->running = -1;
+    cpu->free_since = now;
+
+    if (table->remaining[idx] == 0) {
+        table->completion[idx] = now;
+        (*completed)++;
+        return -1;
+    }
+
+    if (st->config->policy == SMP_MLFQ) {
+        const mlfq_config_t *mlfq = &st->config->mlfq;
+        int level = table->queue_level[idx];
+        if (table->quantum_used[idx] + run >= mlfq->quantums[level]) {
+            // Quantum agotado: bajar un nivel
+            table->quantum_used[idx] = 0;
+            if (level < mlfq->num_queues - 1) table->queue_level[idx] = level + 1;
+        } else {
+            table->quantum_used[idx] += run;
+        }
+    }
+    return idx;
+}
+
+/**
+ * @brief Despacha el siguiente proceso de la cola de la CPU c en el instante now.
+ */
+static void cpu_dispatch(smp_state_t *st, int c, int now) {
+    smp_cpu_t *cpu = &st->cpus[c];
+    proc_table_t *table = &st->table;
+    timeline_t *timeline = &st->timelines[c];
+
+    int idx = cpu_pop(st, c);
+    if (idx == -1) return;
+
+    if (cpu->free_since < now) {
+        timeline_append(timeline, cpu->free_since, -1, now - cpu->free_since); // IDLE
+    }
+    // Si el mismo proceso continúa sin pausa, se extiende su segmento
+    timeline_event_t *last = timeline->count > 0 ? &timeline->events[timeline->count - 1] : NULL;
+    if (!last || last->pid != table->pid[idx] || last->time + last->duration != now) {
+        timeline_append(timeline, now, table->pid[idx], 0);
+    }
+    if (table->start[idx] == -1) {
+        table->start[idx] = now;
+    }
+
+    int slice = table->remaining[idx];
+    if (st->config->policy == SMP_RR && st->config->quantum < slice) {
+        slice = st->config->quantum;
+    } else if (st->config->policy == SMP_MLFQ) {
+        int left = st->config->mlfq.quantums[table->queue_level[idx]] - table->quantum_used[idx];
+        if (left < slice) slice = left;
+    }
+
+    cpu->running = idx;
+    cpu->seg_start = now;
+    cpu->slice_end = now + slice;
+}
+
+/**
+ * @brief Migra procesos de la CPU más cargada a la menos cargada hasta que sus
+ * cargas difieran en a lo sumo 1.
+ */
+static void balance_load(smp_state_t *st) {
+    int num_cpus = st->config->num_cpus;
+    for (;;) {
+        int busiest = -1;
+        int idlest = 0;
+        for (int c = 0; c < num_cpus; c++) {
+            if (st->cpus[c].queued > 0 && (busiest == -1 || cpu_load(&st->cpus[c]) > cpu_load(&st->cpus[busiest]))) {
+                busiest = c;
+            }
+            if (cpu_load(&st->cpus[c]) < cpu_load(&st->cpus[idlest])) {
+                idlest = c;
+            }
+        }
+        if (busiest == -1 || cpu_load(&st->cpus[busiest]) - cpu_load(&st->cpus[idlest]) <= 1) return;
+        cpu_push(st, idlest, cpu_pop(st, busiest));
+    }
+}
+
+static int validate_config(const smp_config_t *config) {
+    if (config->num_cpus < 1) {
+        fprintf(stderr, "SMP: número de CPUs inválido (%d)\n", config->num_cpus);
+        return -1;
+    }
+    if (config->policy == SMP_RR && config->quantum < 1) {
+        fprintf(stderr, "SMP: quantum inválido (%d)\n", config->quantum);
+        return -1;
+    }
+    if (config->policy == SMP_MLFQ) {
+        if (config->mlfq.num_queues < 1 || config->mlfq.num_queues > MAX_QUEUES) {
+            fprintf(stderr, "SMP: número de colas MLFQ inválido (%d)\n", config->mlfq.num_queues);
+            return -1;
+        }
+        for (int level = 0; level < config->mlfq.num_queues; level++) {
+            if (config->mlfq.quantums[level] < 1) {
+                fprintf(stderr, "SMP: quantum MLFQ inválido en Q%d\n", level);
+                return -1;
+            }
+        }
+    }
+    if (config->balance_interval < 0) {
+        fprintf(stderr, "SMP: intervalo de balanceo inválido (%d)\n", config->balance_interval);
+        return -1;
+    }
+    return 0;
+}
+
+static int compare_arrival_index(const void *a, const void *b) {
+    long long x = *(const long long *)a;
+    long long y = *(const long long *)b;
+    return (x > y) - (x < y);
+}
+
+int schedule_smp(process_t *processes, int n, const smp_config_t *config, timeline_t *timelines) {
+    if (validate_config(config) != 0) return -1;
+
+    int num_cpus = config->num_cpus;
+    smp_state_t st = {config, {0}, NULL, timelines, NULL, 0, 0};
+    for (int c = 0; c < num_cpus; c++) timeline_clear(&timelines[c]);
+    if (proc_table_load(&st.table, processes, n) != 0) return -1;
+    proc_table_t *table = &st.table;
+
+    // Lista de llegadas: (arrival_time, índice) de los procesos con trabajo pendiente
+    long long *keys = malloc((n > 0 ? n : 1) * sizeof(long long));
+    int *arrivals = malloc((n > 0 ? n : 1) * sizeof(int));
+    int *queue_next = malloc((n > 0 ? n : 1) * sizeof(int));
+    st.proc_epoch = malloc((n > 0 ? n : 1) * sizeof(int));
+    st.cpus = calloc(num_cpus, sizeof(smp_cpu_t));
+    if (!keys || !arrivals || !queue_next || !st.proc_epoch || !st.cpus) {
+        perror("Fallo en la asignación de memoria para la simulación SMP");
+        free(keys);
+        free(arrivals);
+        free(queue_next);
+        free(st.proc_epoch);
+        free(st.cpus);
+        proc_table_free(table);
+        return -1;
+    }
+    int num_arrivals = 0;
+    for (int i = 0; i < n; i++) {
+        if (table->remaining[i] > 0) keys[num_arrivals++] = (long long)table->arrival[i] * 4294967296LL + i;
+    }
+    qsort(keys, num_arrivals, sizeof(long long), compare_arrival_index);
+    for (int i = 0; i < num_arrivals; i++) arrivals[i] = (int)(keys[i] & 0xFFFFFFFFLL);
+    free(keys);
+
+    int heap_ok = 1;
+    for (int c = 0; c < num_cpus; c++) {
+        smp_cpu_t *cpu = &st.cpus[c];
+        cpu->running = -1;
+        cpu->pending = -1;
+        level_queue_init(&cpu->levels, queue_next);
+        if (config->policy == SMP_STCF && ready_queue_init(&cpu->heap, 16, compare_remaining, table) != 0) {
+            heap_ok = 0;
+        }
+    }
+
+    int boost_interval = config->policy == SMP_MLFQ ? config->mlfq.boost_interval : 0;
+    long long next_boost = boost_interval > 0 ? boost_interval : -1;
+    long long next_balance = config->balance_interval > 0 ? config->balance_interval : -1;
+    int now = 0;
+    int next = 0;
+    int completed = 0;
+
+    while (heap_ok && completed < num_arrivals) {
+        // 1. Detener los procesos cuyo tramo termina ahora
+        for (int c = 0; c < num_cpus; c++) {
+            if (st.cpus[c].running != -1 && st.cpus[c].slice_end == now) {
+                st.cpus[c].pending = cpu_stop(&st, c, now, &completed);
+            }
+        }
+
+        // 2. Llegadas: a la CPU menos cargada (en MLFQ desalojan al proceso en ejecución)
+        while (next < num_arrivals && table->arrival[arrivals[next]] <= now) {
+            int idx = arrivals[next++];
+            int target = 0;
+            for (int c = 1; c < num_cpus; c++) {
+                int load = cpu_load(&st.cpus[c]) + (st.cpus[c].pending != -1);
+                if (load < cpu_load(&st.cpus[target]) + (st.cpus[target].pending != -1)) target = c;
+            }
+            table->queue_level[idx] = 0;
+            table->quantum_used[idx] = 0;
+            st.proc_epoch[idx] = st.epoch;
+            cpu_push(&st, target, idx);
+            if (config->policy == SMP_MLFQ && st.cpus[target].running != -1) {
+                st.cpus[target].pending = cpu_stop(&st, target, now, &completed);
+            }
+        }
+
+        // 3. Los procesos desalojados vuelven a su cola, detrás de las llegadas
+        for (int c = 0; c < num_cpus; c++) {
+            if (st.cpus[c].pending != -1) {
+                cpu_push(&st, c, st.cpus[c].pending);
+                st.cpus[c].pending = -1;
+            }
+        }
+
+        // 4. STCF: desalojar si hay en cola un proceso con menos tiempo restante
+        if (config->policy == SMP_STCF) {
+            for (int c = 0; c < num_cpus; c++) {
+                smp_cpu_t *cpu = &st.cpus[c];
+                if (cpu->running == -1 || cpu->queued == 0) continue;
+                // Comparar con el tiempo restante actualizado del proceso en ejecución
+                int idx = cpu->running;
+                int elapsed = now - cpu->seg_start;
+                table->remaining[idx] -= elapsed;
+                int preempt = compare_remaining(table, ready_queue_peek(&cpu->heap), idx) < 0;
+                table->remaining[idx] += elapsed;
+                if (preempt) {
+                    cpu_push(&st, c, cpu_stop(&st, c, now, &completed));
+                }
+            }
+        }
+
+        // 5. Priority Boost de MLFQ en todas las CPUs
+        if (next_boost != -1 && now >= next_boost) {
+            for (int c = 0; c < num_cpus; c++) {
+                smp_cpu_t *cpu = &st.cpus[c];
+                if (cpu->running != -1) {
+                    cpu_push(&st, c, cpu_stop(&st, c, now, &completed));
+                }
+                level_queue_boost(&cpu->levels);
+            }
+            st.epoch++;
+            next_boost = ((long long)now / boost_interval + 1) * boost_interval;
+        }
+
+        // 6. Balanceo periódico
+        if (next_balance != -1 && now >= next_balance) {
+            balance_load(&st);
+            next_balance = ((long long)now / config->balance_interval + 1) * config->balance_interval;
+        }
+
+        // 7. Despachar las CPUs libres; sin cola propia, robar de la más cargada
+        for (int c = 0; c < num_cpus; c++) {
+            smp_cpu_t *cpu = &st.cpus[c];
+            if (cpu->running != -1) continue;
+            if (cpu->queued == 0 && st.total_queued > 0) {
+                int victim = busiest_queue(&st);
+                cpu_push(&st, c, cpu_pop(&st, victim));
+            }
+            cpu_dispatch(&st, c, now);
+        }
+
+        // 8. Siguiente evento
+        long long next_time = -1;
+        int active = st.total_queued > 0;
+        if (next < num_arrivals) next_time = table->arrival[arrivals[next]];
+        for (int c = 0; c < num_cpus; c++) {
+            smp_cpu_t *cpu = &st.cpus[c];
+            if (cpu->running != -1) {
+                active = 1;
+                if (next_time == -1 || cpu->slice_end < next_time) next_time = cpu->slice_end;
+            }
+        }
+        if (active && next_boost != -1 && next_boost < next_time) next_time = next_boost;
+        if (st.total_queued > 0 && next_balance != -1 && next_balance < next_time) next_time = next_balance;
+        if (next_time == -1) break;
+
+        // Sin procesos activos los boosts y balanceos intermedios no tienen efecto
+        if (!active) {
+            if (next_boost != -1 && next_time > next_boost) {
+                st.epoch++;
+                next_boost = (next_time / boost_interval + 1) * boost_interval;
+            }
+            if (next_balance != -1 && next_time > next_balance) {
+                next_balance = (next_time / config->balance_interval + 1) * config->balance_interval;
+            }
+        }
+        now = (int)next_time;
+    }
+
+    // 9. Finalizar las líneas de tiempo (todas terminan en el mismo instante)
+    for (int c = 0; c < num_cpus; c++) {
+        timeline_append(&timelines[c], now, 0, 0);
+        ready_queue_free(&st.cpus[c].heap); // Sin efecto si no se usó (heap == NULL)
+    }
+
+    proc_table_store(table, processes);
+    free(arrivals);
+    free(queue_next);
+    free(st.proc_epoch);
+    free(st.cpus);
+    proc_table_free(table);
+    return heap_ok ? 0 : -1;
+}
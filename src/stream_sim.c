@@ -0,0 +1,316 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include "../include/stream_sim.h"
+#include "../include/ready_queue.h"
+
+#define INITIAL_SLOTS 1024
+
+// --- Slots de los Procesos en el Sistema ---
+
+/**
+ * @brief Columnas de los procesos llegados y sin terminar (como proc_table_t),
+ * indexadas por slot. Los slots libres se reutilizan desde una pila.
+ */
+typedef struct {
+    int *arrival;
+    int *burst;
+    int *remaining;
+    int *start;
+    int *deadline;
+    long long *seq;             // Orden de llegada: desempata como el índice en algorithms.c
+    int *free_slots;            // Pila de slots libres
+    int num_free;
+    int used;                   // Slots ocupados
+    int capacity;
+} slot_pool_t;
+
+static void *grow_column(void *column, int capacity, size_t size, int *failed) {
+    void *grown = realloc(column, (size_t)capacity * size);
+    if (!grown) {
+        *failed = 1;
+        return column;
+    }
+    return grown;
+}
+
+static int slot_pool_grow(slot_pool_t *pool) {
+    int capacity = pool->capacity ? pool->capacity * 2 : INITIAL_SLOTS;
+    int failed = 0;
+    pool->arrival = grow_column(pool->arrival, capacity, sizeof(int), &failed);
+    pool->burst = grow_column(pool->burst, capacity, sizeof(int), &failed);
+    pool->remaining = grow_column(pool->remaining, capacity, sizeof(int), &failed);
+    pool->start = grow_column(pool->start, capacity, sizeof(int), &failed);
+    pool->deadline = grow_column(pool->deadline, capacity, sizeof(int), &failed);
+    pool->seq = grow_column(pool->seq, capacity, sizeof(long long), &failed);
+    pool->free_slots = grow_column(pool->free_slots, capacity, sizeof(int), &failed);
+    if (failed) {
+        perror("Fallo en la asignación de memoria para los procesos en el sistema");
+        return -1;
+    }
+
+    // Los slots nuevos quedan libres (el menor en el tope de la pila)
+    for (int slot = capacity - 1; slot >= pool->capacity; slot--) {
+        pool->free_slots[pool->num_free++] = slot;
+    }
+    pool->capacity = capacity;
+    return 0;
+}
+
+static void slot_pool_free(slot_pool_t *pool) {
+    free(pool->arrival);
+    free(pool->burst);
+    free(pool->remaining);
+    free(pool->start);
+    free(pool->deadline);
+    free(pool->seq);
+    free(pool->free_slots);
+    memset(pool, 0, sizeof(slot_pool_t));
+}
+
+/**
+ * @brief Ocupa un slot con el proceso recién llegado.
+ * @return El slot, o -1 si falló la memoria.
+ */
+static int slot_pool_take(slot_pool_t *pool, const process_t *process, long long seq) {
+    if (pool->num_free == 0 && slot_pool_grow(pool) != 0) return -1;
+    int slot = pool->free_slots[--pool->num_free];
+    pool->arrival[slot] = process->arrival_time;
+    pool->burst[slot] = process->burst_time;
+    pool->remaining[slot] = process->burst_time;
+    pool->start[slot] = -1;
+    pool->deadline[slot] = process->deadline;
+    pool->seq[slot] = seq;
+    pool->used++;
+    return slot;
+}
+
+// --- Estado Compartido por los Bucles ---
+
+typedef struct {
+    workload_gen_t *gen;
+    process_t pending;          // Siguiente llegada (vista anticipada)
+    int has_pending;
+    long long arrivals;         // Procesos admitidos
+    slot_pool_t pool;
+    metrics_acc_t *acc;
+    stream_result_t *result;
+} stream_t;
+
+/**
+ * @brief Admite el proceso pendiente y lee el siguiente del generador.
+ * @return Su slot, o -1 si falló la memoria.
+ */
+static int admit_pending(stream_t *stream) {
+    int slot = slot_pool_take(&stream->pool, &stream->pending, stream->arrivals++);
+    if (slot < 0) return -1;
+    if (stream->pool.used > stream->result->peak_in_system) stream->result->peak_in_system = stream->pool.used;
+    stream->has_pending = workload_gen_next(stream->gen, &stream->pending);
+    return slot;
+}
+
+static void complete_slot(stream_t *stream, int slot, int time) {
+    slot_pool_t *pool = &stream->pool;
+    metrics_acc_add(stream->acc, pool->arrival[slot], pool->burst[slot], pool->start[slot], time,
+                    pool->deadline[slot]);
+    pool->free_slots[pool->num_free++] = slot;
+    pool->used--;
+    stream->result->processes++;
+    stream->result->end_time = time;
+}
+
+// --- FIFO y Round Robin (cola circular) ---
+
+/**
+ * @brief Mismo bucle que schedule_rr; FIFO es un quantum que nunca se agota.
+ * La cola crece con la capacidad de los slots, así que nunca se llena.
+ */
+static int run_queue(stream_t *stream, int quantum) {
+    slot_pool_t *pool = &stream->pool;
+    ring_queue_t ready;
+    int current_time = 0;
+    int current_idx = -1;
+    if (ring_queue_init(&ready, INITIAL_SLOTS) != 0) return -1;
+
+    while (stream->has_pending || ready.size > 0) {
+        // 1. Admitir las llegadas hasta el instante actual
+        while (stream->has_pending && stream->pending.arrival_time <= current_time) {
+            int slot = admit_pending(stream);
+            if (slot < 0 || ring_queue_grow(&ready, pool->capacity) != 0) goto fail;
+            ring_queue_push(&ready, slot);
+        }
+
+        // 2. Sin procesos listos: saltar a la siguiente llegada (IDLE)
+        if (ready.size == 0) {
+            current_time = stream->pending.arrival_time;
+            current_idx = -1;
+            continue;
+        }
+
+        // 3. Despachar el primer proceso de la cola
+        int idx = ring_queue_pop(&ready);
+        if (idx != current_idx) {
+            stream->result->dispatches++;
+            if (pool->start[idx] == -1) pool->start[idx] = current_time;
+        }
+        current_idx = idx;
+
+        // 4. Un quantum, o varios si está solo (hasta el que contiene la siguiente llegada)
+        long long run = pool->remaining[idx] < quantum ? pool->remaining[idx] : quantum;
+        if (ready.size == 0 && pool->remaining[idx] > quantum) {
+            long long until = pool->remaining[idx];
+            if (stream->has_pending) {
+                long long gap = stream->pending.arrival_time - current_time;
+                long long slices = (gap + quantum - 1) / quantum;
+                if (slices * quantum < until) until = slices * quantum;
+            }
+            run = until;
+        }
+        pool->remaining[idx] -= (int)run;
+        current_time += (int)run;
+
+        // 5. Las llegadas durante el quantum van antes que el proceso desalojado
+        while (stream->has_pending && stream->pending.arrival_time <= current_time) {
+            int slot = admit_pending(stream);
+            if (slot < 0 || ring_queue_grow(&ready, pool->capacity) != 0) goto fail;
+            ring_queue_push(&ready, slot);
+        }
+
+        // 6. Finalización o regreso al final de la cola
+        if (pool->remaining[idx] == 0) {
+            complete_slot(stream, idx, current_time);
+        } else {
+            ring_queue_push(&ready, idx);
+        }
+    }
+
+    ring_queue_free(&ready);
+    return 0;
+
+fail:
+    ring_queue_free(&ready);
+    return -1;
+}
+
+// --- SJF y STCF (min-heap) ---
+
+/**
+ * @brief Menor remaining_time, luego menor llegada y por último orden de llegada
+ * (el mismo criterio que compare_shortest_remaining en algorithms.c).
+ */
+static int compare_shortest_remaining(const void *ctx, int a, int b) {
+    const slot_pool_t *pool = ctx;
+    if (pool->remaining[a] != pool->remaining[b]) return pool->remaining[a] < pool->remaining[b] ? -1 : 1;
+    if (pool->arrival[a] != pool->arrival[b]) return pool->arrival[a] < pool->arrival[b] ? -1 : 1;
+    return pool->seq[a] < pool->seq[b] ? -1 : (pool->seq[a] > pool->seq[b]);
+}
+
+/**
+ * @brief Mismo bucle que schedule_stcf (preemptive = 1) y schedule_sjf (0).
+ */
+static int run_shortest(stream_t *stream, int preemptive) {
+    slot_pool_t *pool = &stream->pool;
+    ready_queue_t ready;
+    int current_time = 0;
+    int current_idx = -1;
+    if (ready_queue_init(&ready, INITIAL_SLOTS, compare_shortest_remaining, pool) != 0) return -1;
+
+    while (stream->has_pending || ready.size > 0) {
+        // 1. Admitir las llegadas hasta el instante actual
+        while (stream->has_pending && stream->pending.arrival_time <= current_time) {
+            int slot = admit_pending(stream);
+            if (slot < 0) {
+                ready_queue_free(&ready);
+                return -1;
+            }
+            ready_queue_push(&ready, slot);
+        }
+
+        // 2. Sin procesos listos: saltar a la siguiente llegada (IDLE)
+        if (ready.size == 0) {
+            current_time = stream->pending.arrival_time;
+            continue;
+        }
+
+        // 3. SJF: el trabajo más corto se ejecuta hasta completarse
+        if (!preemptive) {
+            int idx = ready_queue_pop(&ready);
+            stream->result->dispatches++;
+            pool->start[idx] = current_time;
+            current_time += pool->remaining[idx];
+            pool->remaining[idx] = 0;
+            complete_slot(stream, idx, current_time);
+            continue;
+        }
+
+        // 4. STCF: el proceso en ejecución permanece en la raíz del heap
+        int idx = ready_queue_peek(&ready);
+        if (idx != current_idx) {
+            stream->result->dispatches++;
+            if (pool->start[idx] == -1) pool->start[idx] = current_time;
+        }
+        current_idx = idx;
+
+        // 5. Ejecutar hasta la siguiente llegada o hasta terminar
+        int run = pool->remaining[idx];
+        if (stream->has_pending && stream->pending.arrival_time - current_time < run) {
+            run = stream->pending.arrival_time - current_time;
+        }
+        pool->remaining[idx] -= run;
+        current_time += run;
+
+        if (pool->remaining[idx] == 0) {
+            ready_queue_pop(&ready);
+            complete_slot(stream, idx, current_time);
+            current_idx = -1;
+        }
+    }
+
+    ready_queue_free(&ready);
+    return 0;
+}
+
+int simulate_stream(workload_gen_t *gen, stream_policy_t policy, int quantum,
+                    metrics_acc_t *acc, stream_result_t *result) {
+    memset(result, 0, sizeof(stream_result_t));
+    metrics_acc_reset(acc);
+    if (policy == STREAM_RR && quantum < 1) {
+        fprintf(stderr, "Round Robin: quantum inválido (%d)\n", quantum);
+        return -1;
+    }
+
+    stream_t stream = {.gen = gen, .acc = acc, .result = result};
+    stream.has_pending = workload_gen_next(gen, &stream.pending);
+
+    int status;
+    switch (policy) {
+        case STREAM_FIFO: status = run_queue(&stream, INT_MAX); break;
+        case STREAM_RR: status = run_queue(&stream, quantum); break;
+        case STREAM_SJF: status = run_shortest(&stream, 0); break;
+        default: status = run_shortest(&stream, 1); break;
+    }
+
+    slot_pool_free(&stream.pool);
+    return status;
+}
+
+const char *stream_policy_name(stream_policy_t policy) {
+    switch (policy) {
+        case STREAM_FIFO: return "FIFO";
+        case STREAM_SJF: return "SJF";
+        case STREAM_STCF: return "STCF";
+        case STREAM_RR: return "RR";
+    }
+    return "?";
+}
+
+int stream_parse_policy(const char *name, stream_policy_t *policy) {
+    for (int p = STREAM_FIFO; p <= STREAM_RR; p++) {
+        if (strcasecmp(name, stream_policy_name((stream_policy_t)p)) == 0) {
+            *policy = (stream_policy_t)p;
+            return 0;
+        }
+    }
+    return -1;
+}
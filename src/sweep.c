@@ -0,0 +1,331 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h>
+#include "../include/scheduler.h"
+#include "../include/algorithms.h"
+#include "../include/metrics.h"
+#include "../include/buffers.h"
+#include "../include/sweep.h"
+
+int sweep_parse_range(const char *text, sweep_range_t *range) {
+    int values[3] = {0, 0, 1};
+    int count = 0;
+    const char *p = text;
+
+    for (;;) {
+        char *end;
+        long v = strtol(p, &end, 10);
+        if (end == p || v < INT_MIN || v > INT_MAX) return -1;
+        values[count++] = (int)v;
+        if (*end == '\0') break;
+        if (*end != ':' || count == 3) return -1;
+        p = end + 1;
+    }
+
+    range->min = values[0];
+    range->max = count >= 2 ? values[1] : values[0];
+    range->step = count == 3 ? values[2] : 1;
+    return range->step > 0 ? 0 : -1;
+}
+
+/**
+ * @brief Número de valores del rango (0 si está vacío).
+ */
+static int range_count(const sweep_range_t *range) {
+    if (range->step <= 0 || range->max < range->min) return 0;
+    return (int)(((long long)range->max - range->min) / range->step + 1);
+}
+
+static int range_value(const sweep_range_t *range, int i) {
+    return range->min + i * range->step;
+}
+
+int sweep_expand(const sweep_grid_t *grid, sweep_config_t **configs) {
+    // Las configuraciones inválidas (quantum < 1, colas fuera de [1, MAX_QUEUES]) se descartan
+    int rr_count = range_count(&grid->rr_quantum);
+    long long mlfq_count = (long long)range_count(&grid->mlfq_queues) * range_count(&grid->mlfq_quantum) *
+                           range_count(&grid->mlfq_factor) * range_count(&grid->mlfq_boost);
+    long long total = rr_count + mlfq_count;
+    if (total > INT_MAX) {
+        fprintf(stderr, "La rejilla de barrido es demasiado grande (%lld configuraciones)\n", total);
+        return -1;
+    }
+
+    sweep_config_t *out = malloc((total > 0 ? total : 1) * sizeof(sweep_config_t));
+    if (!out) {
+        perror("Fallo en la asignación de memoria para el barrido");
+        return -1;
+    }
+
+    int count = 0;
+    for (int i = 0; i < rr_count; i++) {
+        int q = range_value(&grid->rr_quantum, i);
+        if (q < 1) continue;
+        out[count] = (sweep_config_t){0};
+        out[count].kind = SWEEP_RR;
+        out[count].quantum = q;
+        count++;
+    }
+
+    int nq_count = range_count(&grid->mlfq_queues);
+    int base_count = range_count(&grid->mlfq_quantum);
+    int factor_count = range_count(&grid->mlfq_factor);
+    int boost_count = range_count(&grid->mlfq_boost);
+    for (int a = 0; a < nq_count; a++) {
+        int num_queues = range_value(&grid->mlfq_queues, a);
+        if (num_queues < 1 || num_queues > MAX_QUEUES) continue;
+        for (int b = 0; b < base_count; b++) {
+            int base = range_value(&grid->mlfq_quantum, b);
+            if (base < 1) continue;
+            for (int c = 0; c < factor_count; c++) {
+                int factor = range_value(&grid->mlfq_factor, c);
+                if (factor < 1) continue;
+                for (int d = 0; d < boost_count; d++) {
+                    int boost = range_value(&grid->mlfq_boost, d);
+                    if (boost < 0) continue;
+
+                    sweep_config_t *cfg = &out[count++];
+                    cfg->kind = SWEEP_MLFQ;
+                    cfg->quantum = 0;
+                    cfg->mlfq.num_queues = num_queues;
+                    cfg->mlfq.boost_interval = boost;
+                    long long q = base;
+                    for (int level = 0; level < MAX_QUEUES; level++) {
+                        cfg->mlfq.quantums[level] = level < num_queues ? (int)q : 0;
+                        q = q * factor > INT_MAX ? INT_MAX : q * factor;
+                    }
+                }
+            }
+        }
+    }
+
+    *configs = out;
+    return count;
+}
+
+int sweep_default_threads(void) {
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    return cores > 0 ? (int)cores : 1;
+}
+
+// --- Pool con robo de trabajo ---
+//
+// Cada hilo posee un rango contiguo [begin, end) de índices de configuraciones
+// empaquetado en un único entero atómico de 64 bits (begin en la parte alta).
+// El dueño toma tareas del final; un hilo sin trabajo roba la mitad inicial del
+// rango de otro con un CAS y la instala como su propio rango. Los índices nunca
+// vuelven a un rango después de tomarse, por lo que no hay problema ABA.
+
+#define RANGE_PACK(begin, end) (((uint64_t)(uint32_t)(begin) << 32) | (uint32_t)(end))
+#define RANGE_BEGIN(r) ((int)((r) >> 32))
+#define RANGE_END(r) ((int)((r) & 0xFFFFFFFFu))
+
+typedef struct {
+    _Atomic uint64_t range;
+    char pad[64 - sizeof(uint64_t)];    // Evitar false sharing entre hilos
+} sweep_deque_t;
+
+typedef struct {
+    process_t *original_processes;
+    int n;
+    const sweep_config_t *configs;
+    sweep_result_t *results;
+    sweep_deque_t *deques;
+    int num_threads;
+} sweep_pool_t;
+
+typedef struct {
+    sweep_pool_t *pool;
+    int id;
+} sweep_worker_t;
+
+/**
+ * @brief Toma la última tarea del rango propio.
+ * @return El índice de la tarea, o -1 si el rango está vacío.
+ */
+static int sweep_pop(sweep_deque_t *deque) {
+    uint64_t r = atomic_load(&deque->range);
+    while (RANGE_BEGIN(r) < RANGE_END(r)) {
+        uint64_t next = RANGE_PACK(RANGE_BEGIN(r), RANGE_END(r) - 1);
+        if (atomic_compare_exchange_weak(&deque->range, &r, next)) {
+            return RANGE_END(r) - 1;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Roba la mitad inicial del rango de otro hilo y la instala en el propio.
+ * @return Una tarea robada para ejecutar de inmediato, o -1 si no hay trabajo en ningún hilo.
+ */
+static int sweep_steal(sweep_pool_t *pool, int self) {
+    for (int k = 1; k < pool->num_threads; k++) {
+        sweep_deque_t *victim = &pool->deques[(self + k) % pool->num_threads];
+        uint64_t r = atomic_load(&victim->range);
+        while (RANGE_BEGIN(r) < RANGE_END(r)) {
+            int begin = RANGE_BEGIN(r);
+            int end = RANGE_END(r);
+            int take = (end - begin + 1) / 2;
+            if (atomic_compare_exchange_weak(&victim->range, &r, RANGE_PACK(begin + take, end))) {
+                // Ejecutar la primera tarea robada y dejar el resto disponible
+                atomic_store(&pool->deques[self].range, RANGE_PACK(begin + 1, begin + take));
+                return begin;
+            }
+        }
+    }
+    return -1;
+}
+
+static void run_sweep_config(sweep_pool_t *pool, int i, process_set_t *current, timeline_t *timeline) {
+    const sweep_config_t *cfg = &pool->configs[i];
+    sweep_result_t *result = &pool->results[i];
+    int n = pool->n;
+
+    process_set_reset(current, pool->original_processes, n);
+    process_t *processes = current->items;
+
+    if (cfg->kind == SWEEP_RR) {
+        schedule_rr(processes, n, cfg->quantum, timeline);
+    } else {
+        mlfq_config_t mlfq = cfg->mlfq; // Copia privada: el planificador recibe un puntero no constante
+        schedule_mlfq(processes, n, &mlfq, timeline);
+    }
+
+    // El planificador llenó el acumulador de timeline->stats al completar cada proceso
+    result->config = *cfg;
+    result->total_time = metrics_acc_finish(timeline->stats, &result->metrics);
+}
+
+static void *sweep_worker(void *arg) {
+    sweep_worker_t *worker = arg;
+    sweep_pool_t *pool = worker->pool;
+
+    // Buffers privados del hilo, reutilizados entre configuraciones
+    process_set_t current;
+    timeline_t timeline;
+    metrics_acc_t acc;
+    process_set_init(&current);
+    timeline_init(&timeline);
+    timeline.stats = &acc;
+
+    for (;;) {
+        int i = sweep_pop(&pool->deques[worker->id]);
+        if (i < 0) i = sweep_steal(pool, worker->id);
+        if (i < 0) break; // Ningún hilo tiene trabajo pendiente
+        run_sweep_config(pool, i, &current, &timeline);
+    }
+
+    timeline_free(&timeline);
+    process_set_free(&current);
+    return NULL;
+}
+
+int run_sweep(process_t *original_processes, int n, const sweep_config_t *configs, int count,
+              sweep_result_t *results, int num_threads) {
+    if (count <= 0) return 0;
+    if (num_threads < 1) num_threads = 1;
+    if (num_threads > count) num_threads = count;
+
+    sweep_deque_t *deques = aligned_alloc(64, num_threads * sizeof(sweep_deque_t));
+    sweep_worker_t *workers = malloc(num_threads * sizeof(sweep_worker_t));
+    pthread_t *threads = malloc(num_threads * sizeof(pthread_t));
+    int *started = malloc(num_threads * sizeof(int));
+    if (!deques || !workers || !threads || !started) {
+        perror("Fallo en la asignación de memoria para el pool de barrido");
+        free(deques);
+        free(workers);
+        free(threads);
+        free(started);
+        return -1;
+    }
+
+    sweep_pool_t pool = {original_processes, n, configs, results, deques, num_threads};
+
+    // Reparto inicial en bloques contiguos; el robo equilibra configuraciones de coste desigual
+    for (int t = 0; t < num_threads; t++) {
+        int begin = (int)((long long)count * t / num_threads);
+        int end = (int)((long long)count * (t + 1) / num_threads);
+        atomic_init(&deques[t].range, RANGE_PACK(begin, end));
+        workers[t].pool = &pool;
+        workers[t].id = t;
+    }
+
+    // El hilo llamador actúa como trabajador 0. Si no se puede crear un hilo,
+    // su bloque lo terminan robando los demás.
+    for (int t = 1; t < num_threads; t++) {
+        started[t] = pthread_create(&threads[t], NULL, sweep_worker, &workers[t]) == 0;
+    }
+    sweep_worker(&workers[0]);
+    for (int t = 1; t < num_threads; t++) {
+        if (started[t]) pthread_join(threads[t], NULL);
+    }
+
+    free(deques);
+    free(workers);
+    free(threads);
+    free(started);
+    return 0;
+}
+
+static int compare_sweep_results(const void *a, const void *b) {
+    const metrics_t *ma = &((const sweep_result_t *)a)->metrics;
+    const metrics_t *mb = &((const sweep_result_t *)b)->metrics;
+    if (ma->avg_turnaround_time != mb->avg_turnaround_time)
+        return ma->avg_turnaround_time < mb->avg_turnaround_time ? -1 : 1;
+    if (ma->avg_waiting_time != mb->avg_waiting_time)
+        return ma->avg_waiting_time < mb->avg_waiting_time ? -1 : 1;
+    if (ma->avg_response_time != mb->avg_response_time)
+        return ma->avg_response_time < mb->avg_response_time ? -1 : 1;
+
+    // Empate: orden fijo por configuración para que la tabla sea reproducible
+    const sweep_config_t *ca = &((const sweep_result_t *)a)->config;
+    const sweep_config_t *cb = &((const sweep_result_t *)b)->config;
+    if (ca->kind != cb->kind) return ca->kind < cb->kind ? -1 : 1;
+    if (ca->quantum != cb->quantum) return ca->quantum < cb->quantum ? -1 : 1;
+    if (ca->mlfq.num_queues != cb->mlfq.num_queues) return ca->mlfq.num_queues < cb->mlfq.num_queues ? -1 : 1;
+    for (int level = 0; level < ca->mlfq.num_queues; level++) {
+        if (ca->mlfq.quantums[level] != cb->mlfq.quantums[level])
+            return ca->mlfq.quantums[level] < cb->mlfq.quantums[level] ? -1 : 1;
+    }
+    if (ca->mlfq.boost_interval != cb->mlfq.boost_interval)
+        return ca->mlfq.boost_interval < cb->mlfq.boost_interval ? -1 : 1;
+    return 0;
+}
+
+void sort_sweep_results(sweep_result_t *results, int count) {
+    qsort(results, count, sizeof(sweep_result_t), compare_sweep_results);
+}
+
+/**
+ * @brief Describe una configuración, ej: "RR q=3" o "MLFQ [2,4,8] boost=10".
+ */
+static void format_sweep_config(const sweep_config_t *cfg, char *buf, size_t size) {
+    if (cfg->kind == SWEEP_RR) {
+        snprintf(buf, size, "RR q=%d", cfg->quantum);
+        return;
+    }
+    int len = snprintf(buf, size, "MLFQ [");
+    for (int level = 0; level < cfg->mlfq.num_queues && len < (int)size; level++) {
+        len += snprintf(buf + len, size - len, level ? ",%d" : "%d", cfg->mlfq.quantums[level]);
+    }
+    if (len < (int)size) {
+        snprintf(buf + len, size - len, "] boost=%d", cfg->mlfq.boost_interval);
+    }
+}
+
+void write_sweep_table(FILE *out, const sweep_result_t *results, int count) {
+    char label[128];
+    fprintf(out, "| Rank | Configuration | Avg TAT | Avg WT | Avg RT | Throughput | CPU Util | Fairness |\n");
+    fprintf(out, "|------|---------------|---------|--------|--------|------------|----------|----------|\n");
+    for (int i = 0; i < count; i++) {
+        const metrics_t *m = &results[i].metrics;
+        format_sweep_config(&results[i].config, label, sizeof(label));
+        fprintf(out, "| %-4d | %-13s | %-7.2f | %-6.2f | %-6.2f | %-10.4f | %-8.2f | %-8.4f |\n",
+                i + 1, label, m->avg_turnaround_time, m->avg_waiting_time, m->avg_response_time,
+                m->throughput, m->cpu_utilization, m->fairness_index);
+    }
+}
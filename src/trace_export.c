@@ -0,0 +1,252 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <limits.h>
+#include "../include/trace_export.h"
+
+#define TRACE_PID_CPUS 1        // Proceso del trace con un hilo por CPU
+#define TRACE_PID_PROCESSES 2   // Proceso del trace con un hilo por pid
+
+// --- Escritura con Buffer ---
+
+/**
+ * @brief Escritor con buffer fijo: los eventos se formatean directamente en el
+ * buffer y se vuelcan al archivo cuando se llena.
+ */
+typedef struct {
+    FILE *file;
+    char buffer[TRACE_BUFFER_SIZE];
+    size_t used;
+    int first_event;            // Aún no hay eventos (el siguiente no lleva coma)
+    int error;
+} trace_writer_t;
+
+static void writer_flush(trace_writer_t *writer) {
+    if (writer->used > 0 && fwrite(writer->buffer, 1, writer->used, writer->file) != writer->used) {
+        writer->error = 1;
+    }
+    writer->used = 0;
+}
+
+static void writer_printf(trace_writer_t *writer, const char *format, ...) {
+    // Si no cabe, se vuelca el buffer y se formatea de nuevo (un evento siempre cabe)
+    for (int attempt = 0; attempt < 2; attempt++) {
+        size_t space = sizeof(writer->buffer) - writer->used;
+        va_list args;
+        va_start(args, format);
+        int len = vsnprintf(writer->buffer + writer->used, space, format, args);
+        va_end(args);
+        if (len < 0) break;
+        if ((size_t)len < space) {
+            writer->used += (size_t)len;
+            return;
+        }
+        writer_flush(writer);
+    }
+    writer->error = 1;
+}
+
+/**
+ * @brief Separador entre eventos del array traceEvents.
+ */
+static void writer_next_event(trace_writer_t *writer) {
+    if (!writer->first_event) writer_printf(writer, ",\n");
+    writer->first_event = 0;
+}
+
+// --- Eventos ---
+
+static void write_metadata(trace_writer_t *writer, const char *kind, int pid, int tid,
+                           const char *prefix, int number) {
+    writer_next_event(writer);
+    if (number >= 0) {
+        writer_printf(writer, "{\"name\":\"%s\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":\"%s%d\"}}",
+                      kind, pid, tid, prefix, number);
+    } else {
+        writer_printf(writer, "{\"name\":\"%s\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+                      kind, pid, tid, prefix);
+    }
+}
+
+/**
+ * @brief Un tramo de ejecución: en el hilo de su CPU y en el hilo de su proceso.
+ */
+static void write_segment(trace_writer_t *writer, int cpu, int pid, int time, int duration) {
+    writer_next_event(writer);
+    writer_printf(writer, "{\"name\":\"P%d\",\"ph\":\"X\",\"pid\":%d,\"tid\":%d,\"ts\":%d,\"dur\":%d}",
+                  pid, TRACE_PID_CPUS, cpu, time, duration);
+    writer_next_event(writer);
+    writer_printf(writer, "{\"name\":\"CPU %d\",\"ph\":\"X\",\"pid\":%d,\"tid\":%d,\"ts\":%d,\"dur\":%d}",
+                  cpu, TRACE_PID_PROCESSES, pid, time, duration);
+}
+
+/**
+ * @brief Segmentos de una CPU, fusionando los tramos contiguos del mismo proceso.
+ * IDLE, marcas de fin y segmentos vacíos no se exportan.
+ */
+static void write_cpu_segments(trace_writer_t *writer, int cpu, const timeline_t *timeline) {
+    int pid = 0, start = 0, end = 0;
+    for (int i = 0; i < timeline->count; i++) {
+        const timeline_event_t *ev = &timeline->events[i];
+        if (ev->pid <= 0 || ev->duration <= 0) continue;
+        if (ev->pid == pid && ev->time == end) {
+            end += ev->duration;
+            continue;
+        }
+        if (pid > 0) write_segment(writer, cpu, pid, start, end - start);
+        pid = ev->pid;
+        start = ev->time;
+        end = ev->time + ev->duration;
+    }
+    if (pid > 0) write_segment(writer, cpu, pid, start, end - start);
+}
+
+// --- Contador de la Cola de Listos ---
+
+static int compare_int(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Cursor sobre los tramos ocupados de una CPU.
+ */
+typedef struct {
+    const timeline_t *timeline;
+    int next;                   // Índice del siguiente evento por revisar
+    int busy_until;             // Fin del tramo en curso, o -1 si está libre
+} cpu_cursor_t;
+
+/**
+ * @brief Instante del próximo cambio de estado de la CPU (inicio o fin de un
+ * tramo ocupado), o INT_MAX si ya no hay más.
+ */
+static int cursor_next_change(cpu_cursor_t *cursor) {
+    if (cursor->busy_until != -1) return cursor->busy_until;
+    const timeline_t *timeline = cursor->timeline;
+    while (cursor->next < timeline->count &&
+           (timeline->events[cursor->next].pid <= 0 || timeline->events[cursor->next].duration <= 0)) {
+        cursor->next++;
+    }
+    return cursor->next < timeline->count ? timeline->events[cursor->next].time : INT_MAX;
+}
+
+/**
+ * @brief Recorre en orden de tiempo las llegadas, finalizaciones y cambios de
+ * cada CPU; en cada instante en que cambia, emite el número de procesos listos.
+ * @return 0 si tuvo éxito, -1 si falló la asignación de memoria.
+ */
+static int write_ready_counter(trace_writer_t *writer, const process_t *processes, int n,
+                               const timeline_t *timelines, int num_cpus) {
+    int *arrivals = malloc((n > 0 ? n : 1) * sizeof(int));
+    int *completions = malloc((n > 0 ? n : 1) * sizeof(int));
+    cpu_cursor_t *cursors = malloc(num_cpus * sizeof(cpu_cursor_t));
+    if (!arrivals || !completions || !cursors) {
+        perror("Fallo en la asignación de memoria para el contador del trace");
+        free(arrivals);
+        free(completions);
+        free(cursors);
+        return -1;
+    }
+
+    int num_completions = 0;
+    for (int i = 0; i < n; i++) {
+        arrivals[i] = processes[i].arrival_time;
+        if (processes[i].completion_time > 0) completions[num_completions++] = processes[i].completion_time;
+    }
+    qsort(arrivals, n, sizeof(int), compare_int);
+    qsort(completions, num_completions, sizeof(int), compare_int);
+    for (int c = 0; c < num_cpus; c++) {
+        cursors[c] = (cpu_cursor_t){.timeline = &timelines[c], .next = 0, .busy_until = -1};
+    }
+
+    int a = 0, d = 0, in_system = 0, running = 0, last_value = -1;
+    for (;;) {
+        int t = INT_MAX;
+        if (a < n && arrivals[a] < t) t = arrivals[a];
+        if (d < num_completions && completions[d] < t) t = completions[d];
+        for (int c = 0; c < num_cpus; c++) {
+            int change = cursor_next_change(&cursors[c]);
+            if (change < t) t = change;
+        }
+        if (t == INT_MAX) break;
+
+        while (a < n && arrivals[a] == t) { in_system++; a++; }
+        while (d < num_completions && completions[d] == t) { in_system--; d++; }
+        for (int c = 0; c < num_cpus; c++) {
+            cpu_cursor_t *cursor = &cursors[c];
+            if (cursor->busy_until == t) {
+                cursor->busy_until = -1;
+                running--;
+            }
+            if (cursor->busy_until == -1 && cursor_next_change(cursor) == t) {
+                const timeline_event_t *ev = &cursor->timeline->events[cursor->next++];
+                cursor->busy_until = ev->time + ev->duration;
+                running++;
+            }
+        }
+
+        int ready = in_system - running > 0 ? in_system - running : 0;
+        if (ready != last_value) {
+            writer_next_event(writer);
+            writer_printf(writer, "{\"name\":\"Cola de listos\",\"ph\":\"C\",\"pid\":%d,\"ts\":%d,"
+                                  "\"args\":{\"listos\":%d}}", TRACE_PID_CPUS, t, ready);
+            last_value = ready;
+        }
+    }
+
+    free(arrivals);
+    free(completions);
+    free(cursors);
+    return 0;
+}
+
+// --- Exportación ---
+
+int trace_export_chrome(const char *filename, const process_t *processes, int n,
+                        const timeline_t *timelines, int num_cpus) {
+    trace_writer_t *writer = malloc(sizeof(trace_writer_t));
+    if (!writer) {
+        perror("Fallo en la asignación de memoria para el trace");
+        return -1;
+    }
+    writer->file = fopen(filename, "w");
+    if (!writer->file) {
+        perror("Error al crear el archivo de trace");
+        free(writer);
+        return -1;
+    }
+    writer->used = 0;
+    writer->first_event = 1;
+    writer->error = 0;
+
+    writer_printf(writer, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+    // 1. Nombres de los procesos e hilos del trace
+    write_metadata(writer, "process_name", TRACE_PID_CPUS, 0, "CPUs", -1);
+    write_metadata(writer, "process_name", TRACE_PID_PROCESSES, 0, "Procesos", -1);
+    for (int c = 0; c < num_cpus; c++) {
+        write_metadata(writer, "thread_name", TRACE_PID_CPUS, c, "CPU ", c);
+    }
+    for (int i = 0; i < n; i++) {
+        write_metadata(writer, "thread_name", TRACE_PID_PROCESSES, processes[i].pid, "P", processes[i].pid);
+    }
+
+    // 2. Tramos de ejecución de cada CPU
+    for (int c = 0; c < num_cpus; c++) {
+        write_cpu_segments(writer, c, &timelines[c]);
+    }
+
+    // 3. Contador de procesos listos
+    int status = write_ready_counter(writer, processes, n, timelines, num_cpus);
+
+    writer_printf(writer, "\n]}\n");
+    writer_flush(writer);
+    if (writer->error) status = -1;
+    if (fclose(writer->file) != 0) status = -1;
+    if (status != 0) {
+        perror("Error al escribir el archivo de trace");
+    }
+    free(writer);
+    return status;
+}
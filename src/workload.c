@@ -0,0 +1,351 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "../include/workload.h"
+
+#define WORKLOAD_COLUMNS 4 // PID, Arrival Time, Burst Time, Priority (+ Deadline opcional)
+#define WRITE_CHUNK 65536  // Valores por escritura al generar columnas binarias
+
+// Las columnas binarias se leen y escriben en el orden de bytes del host
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "El formato binario de workloads requiere un host little-endian"
+#endif
+
+static int load_workload_bin(const char *filename, process_set_t *set);
+
+/**
+ * @brief Cursor sobre el contenido mapeado del archivo.
+ */
+typedef struct {
+    const char *pos;
+    const char *end;
+    int line;
+} parser_t;
+
+static void skip_blanks(parser_t *parser) {
+    while (parser->pos < parser->end && (*parser->pos == ' ' || *parser->pos == '\t' || *parser->pos == '\r')) {
+        parser->pos++;
+    }
+}
+
+static void skip_line(parser_t *parser) {
+    const char *newline = memchr(parser->pos, '\n', parser->end - parser->pos);
+    parser->pos = newline ? newline + 1 : parser->end;
+    parser->line++;
+}
+
+/**
+ * @brief Interpreta un entero decimal (con signo opcional) en la posición actual.
+ * @return 0 si tuvo éxito, -1 si no hay dígitos.
+ */
+static int parse_int(parser_t *parser, int *value) {
+    const char *p = parser->pos;
+    int negative = 0;
+    long long result = 0;
+
+    if (p < parser->end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        p++;
+    }
+    const char *digits = p;
+    while (p < parser->end && (unsigned)(*p - '0') < 10u && result <= 2147483647LL) {
+        result = result * 10 + (*p - '0');
+        p++;
+    }
+    if (p == digits || result > 2147483647LL) return -1;
+
+    *value = (int)(negative ? -result : result);
+    parser->pos = p;
+    return 0;
+}
+
+/**
+ * @brief Valores que los planificadores pueden simular: llegada >= 0, burst >= 1
+ * y deadline >= 0 (0 = sin deadline).
+ */
+static int valid_process_values(int arrival, int burst, int deadline) {
+    return arrival >= 0 && burst >= 1 && deadline >= 0;
+}
+
+/**
+ * @brief Interpreta una línea de datos ya posicionada en su primer carácter útil.
+ * @return 0 si tuvo éxito, -1 si la línea está mal formada, -2 si algún valor
+ * está fuera de rango (ver valid_process_values).
+ */
+static int parse_process(parser_t *parser, process_t *process) {
+    int fields[WORKLOAD_COLUMNS + 1] = {0}; // + Deadline (0 si se omite)
+    int columns = 0;
+
+    for (;;) {
+        skip_blanks(parser);
+        if (parse_int(parser, &fields[columns]) != 0) return -1;
+        columns++;
+        skip_blanks(parser);
+        if (parser->pos >= parser->end || *parser->pos != ',') break;
+        if (columns == WORKLOAD_COLUMNS + 1) return -1;
+        parser->pos++;
+    }
+    if (columns < WORKLOAD_COLUMNS) return -1;
+    if (parser->pos < parser->end && *parser->pos != '\n') return -1;
+    if (!valid_process_values(fields[1], fields[2], fields[WORKLOAD_COLUMNS])) return -2;
+
+    memset(process, 0, sizeof(*process));
+    process->pid = fields[0];
+    process->arrival_time = fields[1];
+    process->burst_time = fields[2];
+    process->priority = fields[3];
+    process->deadline = fields[4];
+    process->remaining_time = process->burst_time;
+    process->start_time = -1;
+    return 0;
+}
+
+int workload_is_bin(const char *filename) {
+    char magic[sizeof(((workload_bin_header_t *)0)->magic)];
+    FILE *probe = fopen(filename, "rb");
+    if (!probe) return 0;
+    size_t got = fread(magic, 1, sizeof(magic), probe);
+    fclose(probe);
+    return got == sizeof(magic) && memcmp(magic, WORKLOAD_BIN_MAGIC, sizeof(magic)) == 0;
+}
+
+int load_workload(const char *filename, process_set_t *set) {
+    // Detectar el formato binario por su firma
+    if (workload_is_bin(filename)) {
+        return load_workload_bin(filename, set);
+    }
+
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        perror("Error al abrir el workload");
+        return -1;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        perror("Error al leer el tamaño del workload");
+        close(fd);
+        return -1;
+    }
+
+    set->count = 0;
+    if (st.st_size == 0) {
+        close(fd);
+        return 0;
+    }
+
+    const char *data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        perror("Error al mapear el workload en memoria");
+        return -1;
+    }
+    madvise((void *)data, (size_t)st.st_size, MADV_SEQUENTIAL);
+
+    parser_t parser = {data, data + st.st_size, 1};
+    int status = 0;
+
+    // Reservar de una vez: el número de líneas acota el número de procesos
+    int lines = 0;
+    for (const char *p = data; (p = memchr(p, '\n', parser.end - p)) != NULL; p++) {
+        lines++;
+    }
+    process_set_reserve(set, lines + 1);
+
+    while (parser.pos < parser.end) {
+        skip_blanks(&parser);
+        if (parser.pos >= parser.end) break;
+
+        // Comentarios y líneas vacías
+        if (*parser.pos == '#' || *parser.pos == '\n') {
+            skip_line(&parser);
+            continue;
+        }
+
+        int parsed = parse_process(&parser, &set->items[set->count]);
+        if (parsed == -2) {
+            fprintf(stderr, "Error en %s, línea %d: se requiere Arrival >= 0, Burst >= 1 y Deadline >= 0\n",
+                    filename, parser.line);
+            status = -1;
+            break;
+        }
+        if (parsed != 0) {
+            fprintf(stderr, "Error de formato en %s, línea %d: se esperaba \"PID, Arrival, Burst, Priority[, Deadline]\"\n",
+                    filename, parser.line);
+            status = -1;
+            break;
+        }
+        set->count++;
+        skip_line(&parser);
+    }
+
+    munmap((void *)data, (size_t)st.st_size);
+    if (status != 0) set->count = 0;
+    return status;
+}
+
+// --- Formato Binario Columnar ---
+
+int workload_bin_open(const char *filename, workload_view_t *view) {
+    memset(view, 0, sizeof(*view));
+
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        perror("Error al abrir el workload binario");
+        return -1;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(workload_bin_header_t)) {
+        fprintf(stderr, "Workload binario inválido: %s (archivo truncado)\n", filename);
+        close(fd);
+        return -1;
+    }
+
+    void *map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        perror("Error al mapear el workload binario");
+        return -1;
+    }
+
+    const workload_bin_header_t *header = map;
+    size_t column_bytes = (size_t)header->count * sizeof(int32_t);
+    int has_deadline = (header->flags & WORKLOAD_BIN_FLAG_DEADLINE) != 0;
+    if (memcmp(header->magic, WORKLOAD_BIN_MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != WORKLOAD_BIN_VERSION || header->count > 2147483647ULL ||
+        (size_t)st.st_size < sizeof(*header) + (WORKLOAD_COLUMNS + has_deadline) * column_bytes) {
+        fprintf(stderr, "Workload binario inválido: %s (encabezado o tamaño incorrecto)\n", filename);
+        munmap(map, (size_t)st.st_size);
+        return -1;
+    }
+    madvise(map, (size_t)st.st_size, MADV_SEQUENTIAL);
+
+    const int32_t *columns = (const int32_t *)(header + 1);
+    view->count = (int)header->count;
+    view->pid = columns;
+    view->arrival = columns + view->count;
+    view->burst = columns + 2 * (size_t)view->count;
+    view->priority = columns + 3 * (size_t)view->count;
+    view->deadline = has_deadline ? columns + 4 * (size_t)view->count : NULL;
+    view->map = map;
+    view->map_size = (size_t)st.st_size;
+    return 0;
+}
+
+void workload_bin_close(workload_view_t *view) {
+    if (view->map) {
+        munmap(view->map, view->map_size);
+    }
+    memset(view, 0, sizeof(*view));
+}
+
+int workload_bin_validate(const workload_view_t *view, const char *filename) {
+    for (int i = 0; i < view->count; i++) {
+        if (!valid_process_values(view->arrival[i], view->burst[i], view->deadline ? view->deadline[i] : 0)) {
+            fprintf(stderr, "Error en %s, proceso %d: se requiere Arrival >= 0, Burst >= 1 y Deadline >= 0\n",
+                    filename, i + 1);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Carga un workload binario: copia las columnas mapeadas a set, sin
+ * analizar texto. Para simular sin copiarlas, ver proc_table_load_view.
+ */
+static int load_workload_bin(const char *filename, process_set_t *set) {
+    workload_view_t view;
+    if (workload_bin_open(filename, &view) != 0) return -1;
+    if (workload_bin_validate(&view, filename) != 0) {
+        set->count = 0;
+        workload_bin_close(&view);
+        return -1;
+    }
+
+    process_set_reserve(set, view.count);
+    for (int i = 0; i < view.count; i++) {
+        process_t *process = &set->items[i];
+        memset(process, 0, sizeof(*process));
+        process->pid = view.pid[i];
+        process->arrival_time = view.arrival[i];
+        process->burst_time = view.burst[i];
+        process->priority = view.priority[i];
+        process->deadline = view.deadline ? view.deadline[i] : 0;
+        process->remaining_time = process->burst_time;
+        process->start_time = -1;
+    }
+    set->count = view.count;
+
+    workload_bin_close(&view);
+    return 0;
+}
+
+/**
+ * @brief Escribe una columna (campo en offset dentro de process_t) en bloques de WRITE_CHUNK.
+ */
+static int write_column(FILE *file, const process_t *processes, int n, size_t offset, int32_t *chunk) {
+    for (int base = 0; base < n; base += WRITE_CHUNK) {
+        int len = n - base < WRITE_CHUNK ? n - base : WRITE_CHUNK;
+        for (int i = 0; i < len; i++) {
+            chunk[i] = *(const int *)((const char *)&processes[base + i] + offset);
+        }
+        if (fwrite(chunk, sizeof(int32_t), (size_t)len, file) != (size_t)len) return -1;
+    }
+    return 0;
+}
+
+int workload_bin_write(const char *filename, const process_t *processes, int n) {
+    FILE *file = fopen(filename, "wb");
+    if (!file) {
+        perror("Error al crear el workload binario");
+        return -1;
+    }
+
+    workload_bin_header_t header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, WORKLOAD_BIN_MAGIC, sizeof(header.magic));
+    header.version = WORKLOAD_BIN_VERSION;
+    header.count = (uint64_t)n;
+    for (int i = 0; i < n; i++) {
+        if (processes[i].deadline != 0) {
+            header.flags |= WORKLOAD_BIN_FLAG_DEADLINE;
+            break;
+        }
+    }
+
+    int32_t *chunk = malloc(WRITE_CHUNK * sizeof(int32_t));
+    int status = (chunk && fwrite(&header, sizeof(header), 1, file) == 1) ? 0 : -1;
+    if (status == 0) status = write_column(file, processes, n, offsetof(process_t, pid), chunk);
+    if (status == 0) status = write_column(file, processes, n, offsetof(process_t, arrival_time), chunk);
+    if (status == 0) status = write_column(file, processes, n, offsetof(process_t, burst_time), chunk);
+    if (status == 0) status = write_column(file, processes, n, offsetof(process_t, priority), chunk);
+    if (status == 0 && (header.flags & WORKLOAD_BIN_FLAG_DEADLINE)) {
+        status = write_column(file, processes, n, offsetof(process_t, deadline), chunk);
+    }
+    free(chunk);
+
+    if (fclose(file) != 0) status = -1;
+    if (status != 0) {
+        perror("Error al escribir el workload binario");
+    }
+    return status;
+}
+
+int convert_workload(const char *csv_filename, const char *bin_filename) {
+    process_set_t set;
+    process_set_init(&set);
+
+    int status = load_workload(csv_filename, &set);
+    if (status == 0) {
+        status = workload_bin_write(bin_filename, set.items, set.count);
+    }
+
+    process_set_free(&set);
+    return status;
+}
@@ -0,0 +1,231 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "../include/workload_gen.h"
+
+#define BURST_LIMIT (INT_MAX / 4)   // Tope de seguridad de cualquier ráfaga
+
+// --- Números Aleatorios ---
+
+/**
+ * @brief splitmix64: convierte la semilla (incluso 0) en un estado inicial bien mezclado.
+ */
+static unsigned long long mix_seed(unsigned long long seed) {
+    unsigned long long z = seed + 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z ^= z >> 31;
+    return z ? z : 0x9E3779B97F4A7C15ULL; // xorshift no admite el estado 0
+}
+
+/**
+ * @brief Generador xorshift64*.
+ */
+static unsigned long long next_random(workload_gen_t *gen) {
+    gen->state ^= gen->state >> 12;
+    gen->state ^= gen->state << 25;
+    gen->state ^= gen->state >> 27;
+    return gen->state * 2685821657736338717ULL;
+}
+
+/**
+ * @brief Uniforme en (0, 1]: su logaritmo siempre es finito.
+ */
+static double next_unit(workload_gen_t *gen) {
+    return ((next_random(gen) >> 11) + 1.0) / 9007199254740992.0;
+}
+
+// --- Distribuciones ---
+
+/**
+ * @brief Geométrica en {1, 2, ...} de media mean: la versión discreta de la exponencial.
+ */
+static int geometric(workload_gen_t *gen, double mean) {
+    if (mean <= 1.0) return 1;
+    double value = 1.0 + floor(log(next_unit(gen)) / log1p(-1.0 / mean));
+    return value < BURST_LIMIT ? (int)value : BURST_LIMIT;
+}
+
+/**
+ * @brief Pareto de escala pareto_min redondeada hacia arriba y truncada en max_burst.
+ */
+static int pareto(workload_gen_t *gen) {
+    double value = ceil(gen->pareto_min * pow(next_unit(gen), -1.0 / gen->config.pareto_alpha));
+    if (value > gen->config.max_burst) return gen->config.max_burst;
+    return value < 1.0 ? 1 : (int)value;
+}
+
+static int next_burst(workload_gen_t *gen) {
+    const workload_gen_config_t *config = &gen->config;
+    switch (config->bursts) {
+        case BURST_PARETO: return pareto(gen);
+        case BURST_BIMODAL:
+            if (next_unit(gen) <= config->bimodal_long_fraction) {
+                return geometric(gen, gen->short_mean * config->bimodal_ratio);
+            }
+            return geometric(gen, gen->short_mean);
+        default: return geometric(gen, config->mean_burst);
+    }
+}
+
+/**
+ * @brief Prioridad según la CDF de Zipf (búsqueda binaria).
+ */
+static int next_priority(workload_gen_t *gen) {
+    double u = next_unit(gen);
+    int lo = 0, hi = gen->config.num_priorities - 1;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (gen->priority_cdf[mid] >= u) hi = mid;
+        else lo = mid + 1;
+    }
+    return lo + 1;
+}
+
+/**
+ * @brief Tasa de llegadas de la fase actual. La media de las dos fases de MMPP
+ * (de igual duración media) es la tasa de Poisson: utilization / mean_burst.
+ */
+static double phase_rate(const workload_gen_t *gen) {
+    const workload_gen_config_t *config = &gen->config;
+    double rate = config->utilization / config->mean_burst;
+    if (config->arrivals != ARRIVAL_MMPP) return rate;
+    double quiet = 2.0 * rate / (1.0 + config->mmpp_ratio);
+    return gen->bursting ? quiet * config->mmpp_ratio : quiet;
+}
+
+/**
+ * @brief Avanza el reloj hasta la siguiente llegada. En MMPP, si el intervalo
+ * cruza el fin de la fase, el reloj se detiene ahí y el intervalo se vuelve a
+ * sortear con la nueva tasa (las exponenciales no tienen memoria).
+ */
+static void advance_clock(workload_gen_t *gen) {
+    double gap = -log(next_unit(gen)) / gen->rate;
+    while (gen->config.arrivals == ARRIVAL_MMPP && gen->clock + gap > gen->phase_end) {
+        gen->clock = gen->phase_end;
+        gen->bursting = !gen->bursting;
+        gen->rate = phase_rate(gen);
+        gen->phase_end += -log(next_unit(gen)) * gen->config.mmpp_phase;
+        gap = -log(next_unit(gen)) / gen->rate;
+    }
+    gen->clock += gap;
+}
+
+// --- API ---
+
+void workload_gen_default_config(workload_gen_config_t *config) {
+    memset(config, 0, sizeof(workload_gen_config_t));
+    config->count = 1000;
+    config->seed = 42;
+    config->utilization = 0.9;
+    config->arrivals = ARRIVAL_POISSON;
+    config->mmpp_ratio = 10.0;
+    config->mmpp_phase = 1000.0;
+    config->bursts = BURST_EXPONENTIAL;
+    config->mean_burst = 10.0;
+    config->pareto_alpha = 1.5;
+    config->bimodal_long_fraction = 0.1;
+    config->bimodal_ratio = 20.0;
+    config->max_burst = 1000000;
+    config->num_priorities = 5;
+    config->priority_skew = 0.0;
+}
+
+int workload_gen_init(workload_gen_t *gen, const workload_gen_config_t *config) {
+    memset(gen, 0, sizeof(workload_gen_t));
+    gen->config = *config;
+
+    const char *error = NULL;
+    if (config->count < 0) error = "número de procesos negativo";
+    else if (!(config->utilization > 0)) error = "la utilización debe ser positiva";
+    else if (!(config->mean_burst >= 1)) error = "la ráfaga media debe ser >= 1";
+    else if (config->num_priorities < 1 || config->num_priorities > WORKLOAD_GEN_MAX_PRIORITIES) {
+        error = "número de prioridades fuera de rango";
+    } else if (!(config->priority_skew >= 0)) error = "sesgo de prioridades negativo";
+    else if (config->arrivals == ARRIVAL_MMPP && !(config->mmpp_ratio >= 1 && config->mmpp_phase > 0)) {
+        error = "MMPP requiere ratio >= 1 y fases de duración positiva";
+    } else if (config->bursts == BURST_PARETO && !(config->pareto_alpha > 1 && config->max_burst >= 1)) {
+        error = "Pareto requiere alpha > 1 y max_burst >= 1";
+    } else if (config->bursts == BURST_BIMODAL) {
+        double f = config->bimodal_long_fraction;
+        gen->short_mean = config->mean_burst / (1.0 - f + f * config->bimodal_ratio);
+        if (!(f >= 0 && f <= 1 && config->bimodal_ratio >= 1 && gen->short_mean >= 1)) {
+            error = "bimodal requiere fracción en [0, 1], ratio >= 1 y trabajos cortos de media >= 1";
+        }
+    }
+    if (error) {
+        fprintf(stderr, "Generador de workloads: %s\n", error);
+        return -1;
+    }
+
+    // Pareto de media alpha * x_m / (alpha - 1); el redondeo hacia arriba suma ~0.5
+    gen->pareto_min = (config->mean_burst - 0.5) * (config->pareto_alpha - 1.0) / config->pareto_alpha;
+
+    double total = 0.0;
+    for (int k = 0; k < config->num_priorities; k++) {
+        total += pow(k + 1, -config->priority_skew);
+        gen->priority_cdf[k] = total;
+    }
+    for (int k = 0; k < config->num_priorities; k++) gen->priority_cdf[k] /= total;
+    gen->priority_cdf[config->num_priorities - 1] = 1.0;
+
+    gen->state = mix_seed(config->seed);
+    if (config->arrivals == ARRIVAL_MMPP) {
+        gen->bursting = (int)(next_random(gen) >> 63); // Fase inicial con su probabilidad estacionaria (1/2)
+        gen->phase_end = -log(next_unit(gen)) * config->mmpp_phase;
+    }
+    gen->rate = phase_rate(gen);
+    return 0;
+}
+
+int workload_gen_next(workload_gen_t *gen, process_t *process) {
+    if (gen->generated >= gen->config.count || gen->clock > WORKLOAD_GEN_MAX_ARRIVAL) return 0;
+
+    memset(process, 0, sizeof(*process));
+    process->pid = (int)(++gen->generated);
+    process->arrival_time = (int)gen->clock;
+    process->burst_time = next_burst(gen);
+    process->priority = next_priority(gen);
+    process->remaining_time = process->burst_time;
+    process->start_time = -1;
+
+    advance_clock(gen);
+    return 1;
+}
+
+int workload_gen_fill(workload_gen_t *gen, process_set_t *set) {
+    long long remaining = gen->config.count - gen->generated;
+    if (remaining > 0 && remaining < INT_MAX) process_set_reserve(set, set->count + (int)remaining);
+
+    int added = 0;
+    process_t process;
+    while (workload_gen_next(gen, &process)) {
+        process_set_append(set, &process);
+        added++;
+    }
+    return added;
+}
+
+long long workload_gen_write_csv(workload_gen_t *gen, const char *filename) {
+    FILE *file = fopen(filename, "w");
+    if (!file) {
+        perror("Error al crear el workload generado");
+        return -1;
+    }
+
+    long long written = 0;
+    process_t process;
+    fprintf(file, "# PID, Arrival Time, Burst Time, Priority\n");
+    while (workload_gen_next(gen, &process)) {
+        fprintf(file, "%d, %d, %d, %d\n", process.pid, process.arrival_time,
+                process.burst_time, process.priority);
+        written++;
+    }
+
+    if (ferror(file) | fclose(file)) {
+        perror("Error al escribir el workload generado");
+        return -1;
+    }
+    return written;
+}
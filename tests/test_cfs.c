@@ -0,0 +1,144 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "../include/scheduler.h"
+#include "../include/algorithms.h"
+#include "../include/rbtree.h"
+
+#define NUM_TREE_NODES 200
+
+extern void reset_processes(process_t *processes, int n, process_t *original);
+
+/**
+ * @brief Dos procesos iguales (nice 0) con latencia 4: cada uno recibe 2 unidades
+ * por periodo y se alternan P1, P2, P1, P2.
+ */
+void test_cfs_equal_weights() {
+    printf("--- Ejecutando test_cfs_equal_weights ---\n");
+
+    process_t original[] = {
+        // PID | Arrival | Burst | Priority | Rem | Start | Comp | TAT | WT | RT
+        {1, 0, 4, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+        {2, 0, 4, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0}
+    };
+    process_t processes[2];
+    timeline_t timeline;
+    cfs_config_t config = {.target_latency = 4, .min_granularity = 1};
+    timeline_init(&timeline);
+
+    reset_processes(processes, 2, original);
+    schedule_cfs(processes, 2, &config, &timeline);
+
+    // P1 [0-2], P2 [2-4], P1 [4-6], P2 [6-8]
+    assert(processes[0].start_time == 0 && processes[0].completion_time == 6);
+    assert(processes[1].start_time == 2 && processes[1].completion_time == 8);
+    assert(timeline.events[0].pid == 1 && timeline.events[0].duration == 2);
+    assert(timeline.events[1].pid == 2 && timeline.events[1].duration == 2);
+    assert(timeline.events[2].pid == 1 && timeline.events[2].time == 4);
+    assert(timeline.events[3].pid == 2 && timeline.events[3].time == 6);
+
+    timeline_free(&timeline);
+    printf("--- test_cfs_equal_weights PASSED ---\n");
+}
+
+/**
+ * @brief Con nice 0 frente a nice 5 (peso 1024 frente a 335), P1 recibe ~3/4 de la
+ * CPU mientras ambos compiten, así que termina mucho antes que P2.
+ */
+void test_cfs_weighted_share() {
+    printf("--- Ejecutando test_cfs_weighted_share ---\n");
+
+    process_t original[] = {
+        {1, 0, 100, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+        {2, 0, 100, 5, 0, -1, 0, 0, 0, 0, 0, 0, 0}
+    };
+    process_t processes[2];
+    timeline_t timeline;
+    cfs_config_t config = {.target_latency = 20, .min_granularity = 1};
+    timeline_init(&timeline);
+
+    reset_processes(processes, 2, original);
+    schedule_cfs(processes, 2, &config, &timeline);
+
+    // Reparto ideal: P1 termina en 100 * (1024 + 335) / 1024 ≈ 133
+    assert(processes[0].completion_time >= 125 && processes[0].completion_time <= 140);
+    assert(processes[1].completion_time == 200);
+
+    timeline_free(&timeline);
+    printf("  ✅ P1 (nice 0) termina en T=%d, P2 (nice 5) en T=%d.\n",
+           processes[0].completion_time, processes[1].completion_time);
+    printf("--- test_cfs_weighted_share PASSED ---\n");
+}
+
+static int compare_int_keys(const void *ctx, int a, int b) {
+    const int *keys = ctx;
+    if (keys[a] != keys[b]) return keys[a] < keys[b] ? -1 : 1;
+    return a < b ? -1 : (a > b);
+}
+
+/**
+ * @brief Comprueba las propiedades rojo-negro y devuelve la altura negra del subárbol.
+ */
+static int check_subtree(const rbtree_t *tree, int x, int *count) {
+    if (x == tree->nil) return 1;
+    int l = tree->left[x], r = tree->right[x];
+    if (tree->red[x]) assert(!tree->red[l] && !tree->red[r]);
+    if (l != tree->nil) assert(tree->parent[l] == x && tree->before(tree->ctx, l, x) < 0);
+    if (r != tree->nil) assert(tree->parent[r] == x && tree->before(tree->ctx, x, r) < 0);
+    int hl = check_subtree(tree, l, count);
+    int hr = check_subtree(tree, r, count);
+    assert(hl == hr);
+    (*count)++;
+    return hl + !tree->red[x];
+}
+
+/**
+ * @brief Inserciones y eliminaciones aleatorias: el árbol mantiene sus invariantes
+ * y rbtree_first devuelve siempre el mínimo.
+ */
+void test_rbtree_invariants() {
+    printf("--- Ejecutando test_rbtree_invariants ---\n");
+
+    int keys[NUM_TREE_NODES] = {0};
+    int in_tree[NUM_TREE_NODES] = {0};
+    rbtree_t tree;
+    unsigned int seed = 7;
+    assert(rbtree_init(&tree, NUM_TREE_NODES, compare_int_keys, keys) == 0);
+
+    for (int step = 0; step < 20000; step++) {
+        seed = seed * 1103515245u + 12345u;
+        int idx = (seed >> 16) % NUM_TREE_NODES;
+        if (in_tree[idx]) {
+            rbtree_erase(&tree, idx);
+            in_tree[idx] = 0;
+        } else {
+            seed = seed * 1103515245u + 12345u;
+            keys[idx] = (seed >> 16) % 50; // Claves repetidas: desempata el índice
+            rbtree_insert(&tree, idx);
+            in_tree[idx] = 1;
+        }
+
+        int count = 0, expected = 0, min = -1;
+        assert(!tree.red[tree.root]);
+        check_subtree(&tree, tree.root, &count);
+        for (int i = 0; i < NUM_TREE_NODES; i++) {
+            if (!in_tree[i]) continue;
+            expected++;
+            if (min == -1 || compare_int_keys(keys, i, min) < 0) min = i;
+        }
+        assert(count == expected && tree.size == expected);
+        assert(rbtree_first(&tree) == min);
+    }
+
+    rbtree_free(&tree);
+    printf("  ✅ Invariantes rojo-negro y mínimo en caché correctos.\n");
+    printf("--- test_rbtree_invariants PASSED ---\n");
+}
+
+int main() {
+    test_cfs_equal_weights();
+    test_cfs_weighted_share();
+    test_rbtree_invariants();
+    return 0;
+}
@@ -0,0 +1,201 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "../include/scheduler.h"
+#include "../include/algorithms.h"
+#include "../include/sim_control.h"
+
+#define NUM_RANDOM_PROCESSES 40
+#define NUM_ALGORITHMS 12
+#define NUM_LARGE_PROCESSES 300
+#define LARGE_BURST 200
+
+extern void reset_processes(process_t *processes, int n, process_t *original);
+
+/**
+ * @brief Ejecuta el algoritmo número alg sobre los procesos.
+ */
+static void run_algorithm(int alg, process_t *p, int n, timeline_t *timeline) {
+    mlfq_config_t mlfq = {.num_queues = 3, .quantums = {2, 4, 8}, .boost_interval = 10};
+    cfs_config_t cfs = {.target_latency = 6, .min_granularity = 1};
+    priority_config_t prio = {.preemptive = alg == 11, .aging_interval = 3};
+
+    switch (alg) {
+        case 0: schedule_fifo(p, n, timeline); break;
+        case 1: schedule_sjf(p, n, timeline); break;
+        case 2: schedule_stcf(p, n, timeline); break;
+        case 3: schedule_stcf_tick(p, n, timeline); break;
+        case 4: schedule_rr(p, n, 3, timeline); break;
+        case 5: schedule_mlfq(p, n, &mlfq, timeline); break;
+        case 6: schedule_cfs(p, n, &cfs, timeline); break;
+        case 7: schedule_stride(p, n, 2, timeline); break;
+        case 8: schedule_lottery(p, n, 2, 9, timeline); break;
+        case 9: schedule_edf(p, n, timeline); break;
+        default: schedule_priority(p, n, &prio, timeline); break;
+    }
+}
+
+/**
+ * @brief Workload grande de RR (q=1): un despacho por unidad de tiempo.
+ */
+static process_t *large_workload(void) {
+    process_t *original = calloc(NUM_LARGE_PROCESSES, sizeof(process_t));
+    assert(original);
+    for (int i = 0; i < NUM_LARGE_PROCESSES; i++) {
+        original[i].pid = i + 1;
+        original[i].arrival_time = i;
+        original[i].burst_time = LARGE_BURST;
+    }
+    return original;
+}
+
+typedef struct {
+    int calls;
+    int last_time;
+    int cancel_after;           // Cancela en esta llamada (0 = nunca)
+} progress_log_t;
+
+static void record_progress(sim_control_t *control) {
+    progress_log_t *log = control->user_data;
+    int time = atomic_load(&control->time);
+    assert(time >= log->last_time);
+    log->last_time = time;
+    if (++log->calls == log->cancel_after) sim_control_cancel(control);
+}
+
+/**
+ * @brief Con un control sin cancelación, todos los algoritmos dan los mismos
+ * resultados que sin él y cuentan cada proceso terminado.
+ */
+void test_control_transparent() {
+    printf("--- Ejecutando test_control_transparent ---\n");
+
+    process_t original[NUM_RANDOM_PROCESSES];
+    process_t plain[NUM_RANDOM_PROCESSES];
+    process_t controlled[NUM_RANDOM_PROCESSES];
+    timeline_t timeline_plain, timeline_controlled;
+    sim_control_t control;
+    unsigned int seed = 5;
+    timeline_init(&timeline_plain);
+    timeline_init(&timeline_controlled);
+
+    for (int round = 0; round < 20; round++) {
+        int n = 1 + round % NUM_RANDOM_PROCESSES;
+        for (int i = 0; i < n; i++) {
+            memset(&original[i], 0, sizeof(process_t));
+            original[i].pid = i + 1;
+            seed = seed * 1103515245u + 12345u;
+            original[i].arrival_time = (seed >> 16) % 60;
+            seed = seed * 1103515245u + 12345u;
+            original[i].burst_time = 1 + (seed >> 16) % 15;
+            original[i].priority = 1 + (seed >> 20) % 5;
+        }
+
+        for (int alg = 0; alg < NUM_ALGORITHMS; alg++) {
+            reset_processes(plain, n, original);
+            reset_processes(controlled, n, original);
+            sim_control_init(&control, NULL, NULL);
+            timeline_controlled.control = &control;
+            run_algorithm(alg, plain, n, &timeline_plain);
+            run_algorithm(alg, controlled, n, &timeline_controlled);
+
+            assert(timeline_plain.count == timeline_controlled.count);
+            assert(memcmp(timeline_plain.events, timeline_controlled.events,
+                          timeline_plain.count * sizeof(timeline_event_t)) == 0);
+            for (int i = 0; i < n; i++) {
+                assert(plain[i].completion_time == controlled[i].completion_time);
+            }
+            assert(atomic_load(&control.completed) == n);
+        }
+    }
+
+    timeline_free(&timeline_plain);
+    timeline_free(&timeline_controlled);
+    printf("--- test_control_transparent PASSED ---\n");
+}
+
+/**
+ * @brief El progreso se publica cada SIM_CONTROL_INTERVAL iteraciones con un
+ * tiempo simulado que no retrocede.
+ */
+void test_control_progress() {
+    printf("--- Ejecutando test_control_progress ---\n");
+
+    process_t *original = large_workload();
+    process_t *processes = malloc(NUM_LARGE_PROCESSES * sizeof(process_t));
+    assert(processes);
+    timeline_t timeline;
+    sim_control_t control;
+    progress_log_t log = {0, 0, 0};
+    timeline_init(&timeline);
+    sim_control_init(&control, record_progress, &log);
+    timeline.control = &control;
+
+    reset_processes(processes, NUM_LARGE_PROCESSES, original);
+    schedule_rr(processes, NUM_LARGE_PROCESSES, 1, &timeline);
+
+    int dispatches = NUM_LARGE_PROCESSES * LARGE_BURST;
+    assert(log.calls >= dispatches / SIM_CONTROL_INTERVAL - 1);
+    assert(log.last_time > 0 && log.last_time <= dispatches);
+    assert(atomic_load(&control.completed) == NUM_LARGE_PROCESSES);
+    printf("  ✅ %d publicaciones de progreso en %d despachos\n", log.calls, dispatches);
+
+    timeline_free(&timeline);
+    free(processes);
+    free(original);
+    printf("--- test_control_progress PASSED ---\n");
+}
+
+/**
+ * @brief Una cancelación pedida antes de empezar deja solo la marca de fin; una
+ * pedida durante la simulación la detiene en el siguiente punto de control.
+ */
+void test_control_cancel() {
+    printf("--- Ejecutando test_control_cancel ---\n");
+
+    process_t *original = large_workload();
+    process_t *processes = malloc(NUM_LARGE_PROCESSES * sizeof(process_t));
+    assert(processes);
+    timeline_t timeline;
+    sim_control_t control;
+    timeline_init(&timeline);
+    timeline.control = &control;
+
+    // 1. Antes de empezar: ningún algoritmo ejecuta nada
+    for (int alg = 0; alg < NUM_ALGORITHMS; alg++) {
+        sim_control_init(&control, NULL, NULL);
+        sim_control_cancel(&control);
+        reset_processes(processes, NUM_LARGE_PROCESSES, original);
+        run_algorithm(alg, processes, NUM_LARGE_PROCESSES, &timeline);
+        assert(timeline.count == 1 && timeline.events[0].pid == 0 && timeline.events[0].time == 0);
+        assert(atomic_load(&control.completed) == 0);
+        for (int i = 0; i < NUM_LARGE_PROCESSES; i++) assert(processes[i].completion_time == 0);
+    }
+
+    // 2. Durante la simulación: se detiene en la misma iteración en que se cancela
+    progress_log_t log = {0, 0, 2};
+    sim_control_init(&control, record_progress, &log);
+    reset_processes(processes, NUM_LARGE_PROCESSES, original);
+    schedule_rr(processes, NUM_LARGE_PROCESSES, 1, &timeline);
+
+    assert(log.calls == 2 && sim_control_cancelled(&control));
+    assert(timeline.count <= 2 * SIM_CONTROL_INTERVAL + 1);
+    const timeline_event_t *end = &timeline.events[timeline.count - 1];
+    assert(end->pid == 0 && end->time == log.last_time);
+    int completed = 0;
+    for (int i = 0; i < NUM_LARGE_PROCESSES; i++) completed += processes[i].completion_time > 0;
+    assert(completed == atomic_load(&control.completed) && completed < NUM_LARGE_PROCESSES);
+
+    timeline_free(&timeline);
+    free(processes);
+    free(original);
+    printf("--- test_control_cancel PASSED ---\n");
+}
+
+int main() {
+    test_control_transparent();
+    test_control_progress();
+    test_control_cancel();
+    return 0;
+}
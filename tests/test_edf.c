@@ -0,0 +1,163 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <unistd.h>
+#include "../include/scheduler.h"
+#include "../include/algorithms.h"
+#include "../include/metrics.h"
+#include "../include/workload.h"
+
+// --- Workload de Prueba (workloads/workload4.txt) ---
+// PID 1: Arrival=0, Burst=6, Deadline=8  (absoluto 8)
+// PID 2: Arrival=1, Burst=2, Deadline=12 (absoluto 13)
+// PID 3: Arrival=2, Burst=3, Deadline=9  (absoluto 11)
+// PID 4: Arrival=3, Burst=4, Deadline=14 (absoluto 17)
+// PID 5: Arrival=4, Burst=2, sin deadline
+process_t test_processes[] = {
+    // PID | Arrival | Burst | Priority | Rem | Start | Comp | TAT | WT | RT | Q | Used | Deadline
+    {1, 0, 6, 1, 0, -1, 0, 0, 0, 0, 0, 0, 8},
+    {2, 1, 2, 2, 0, -1, 0, 0, 0, 0, 0, 0, 12},
+    {3, 2, 3, 1, 0, -1, 0, 0, 0, 0, 0, 0, 9},
+    {4, 3, 4, 2, 0, -1, 0, 0, 0, 0, 0, 0, 14},
+    {5, 4, 2, 3, 0, -1, 0, 0, 0, 0, 0, 0, 0}
+};
+const int NUM_TEST_PROCESSES = 5;
+
+extern void reset_processes(process_t *processes, int n, process_t *original);
+
+/**
+ * @brief EDF cumple todos los deadlines: P1 [0-6], P3 [6-9], P2 [9-11], P4 [11-15]
+ * y, al final, P5 (sin deadline) [15-17].
+ */
+void test_schedule_edf() {
+    printf("--- Ejecutando test_schedule_edf ---\n");
+
+    process_t processes[NUM_TEST_PROCESSES];
+    timeline_t timeline;
+    metrics_t metrics;
+    timeline_init(&timeline);
+
+    reset_processes(processes, NUM_TEST_PROCESSES, test_processes);
+    schedule_edf(processes, NUM_TEST_PROCESSES, &timeline);
+
+    int expected_start[] = {0, 9, 6, 11, 15};
+    int expected_completion[] = {6, 11, 9, 15, 17};
+    for (int i = 0; i < NUM_TEST_PROCESSES; i++) {
+        assert(processes[i].start_time == expected_start[i]);
+        assert(processes[i].completion_time == expected_completion[i]);
+    }
+
+    calculate_metrics(processes, NUM_TEST_PROCESSES, 17, &metrics);
+    assert(metrics.deadline_count == 4);
+    assert(metrics.deadline_miss_ratio == 0.0);
+    assert(metrics.max_lateness == -2.0); // Todos terminan 2 unidades antes
+
+    timeline_free(&timeline);
+    printf("--- test_schedule_edf PASSED ---\n");
+}
+
+/**
+ * @brief Una llegada con un deadline anterior desaloja al proceso en ejecución.
+ */
+void test_edf_preemption() {
+    printf("--- Ejecutando test_edf_preemption ---\n");
+
+    process_t original[] = {
+        {1, 0, 10, 0, 0, -1, 0, 0, 0, 0, 0, 0, 20},
+        {2, 2, 3, 0, 0, -1, 0, 0, 0, 0, 0, 0, 4}
+    };
+    process_t processes[2];
+    timeline_t timeline;
+    timeline_init(&timeline);
+
+    reset_processes(processes, 2, original);
+    schedule_edf(processes, 2, &timeline);
+
+    // P1 [0-2], P2 [2-5], P1 [5-13]
+    assert(timeline.events[0].pid == 1 && timeline.events[0].duration == 2);
+    assert(timeline.events[1].pid == 2 && timeline.events[1].duration == 3);
+    assert(timeline.events[2].pid == 1 && timeline.events[2].time == 5);
+    assert(processes[1].completion_time == 5 && processes[0].completion_time == 13);
+
+    timeline_free(&timeline);
+    printf("--- test_edf_preemption PASSED ---\n");
+}
+
+/**
+ * @brief Con la misma carga, STCF y RR incumplen el deadline de P1.
+ */
+void test_deadline_metrics_stcf_rr() {
+    printf("--- Ejecutando test_deadline_metrics_stcf_rr ---\n");
+
+    process_t processes[NUM_TEST_PROCESSES];
+    timeline_t timeline;
+    metrics_t metrics;
+    timeline_init(&timeline);
+
+    // STCF: P1 termina en T=17 (deadline 8)
+    reset_processes(processes, NUM_TEST_PROCESSES, test_processes);
+    schedule_stcf(processes, NUM_TEST_PROCESSES, &timeline);
+    calculate_metrics(processes, NUM_TEST_PROCESSES, 17, &metrics);
+    assert(metrics.deadline_miss_ratio == 0.25);
+    assert(metrics.max_lateness == 9.0);
+
+    // RR (q=3): P1 termina en T=14
+    reset_processes(processes, NUM_TEST_PROCESSES, test_processes);
+    schedule_rr(processes, NUM_TEST_PROCESSES, 3, &timeline);
+    calculate_metrics(processes, NUM_TEST_PROCESSES, 17, &metrics);
+    assert(metrics.deadline_miss_ratio == 0.25);
+    assert(metrics.max_lateness == 6.0);
+
+    timeline_free(&timeline);
+    printf("--- test_deadline_metrics_stcf_rr PASSED ---\n");
+}
+
+/**
+ * @brief La columna Deadline es opcional en el CSV y se conserva al convertir
+ * al formato binario.
+ */
+void test_workload_deadline_column() {
+    printf("--- Ejecutando test_workload_deadline_column ---\n");
+
+    process_set_t set;
+    process_set_init(&set);
+    assert(load_workload("workloads/workload4.txt", &set) == 0);
+    assert(set.count == NUM_TEST_PROCESSES);
+    for (int i = 0; i < NUM_TEST_PROCESSES; i++) {
+        assert(set.items[i].deadline == test_processes[i].deadline);
+    }
+
+    // Ida y vuelta por el formato binario
+    char bin_path[] = "/tmp/test_edf_XXXXXX";
+    int fd = mkstemp(bin_path);
+    assert(fd >= 0);
+    close(fd);
+    assert(convert_workload("workloads/workload4.txt", bin_path) == 0);
+    assert(load_workload(bin_path, &set) == 0);
+    assert(set.count == NUM_TEST_PROCESSES);
+    for (int i = 0; i < NUM_TEST_PROCESSES; i++) {
+        assert(set.items[i].deadline == test_processes[i].deadline);
+        assert(set.items[i].burst_time == test_processes[i].burst_time);
+    }
+
+    // Sin deadlines, el binario no lleva la columna extra
+    assert(load_workload("workloads/workload1.txt", &set) == 0);
+    assert(workload_bin_write(bin_path, set.items, set.count) == 0);
+    workload_view_t view;
+    assert(workload_bin_open(bin_path, &view) == 0);
+    assert(view.deadline == NULL && view.count == 3);
+    workload_bin_close(&view);
+
+    unlink(bin_path);
+    process_set_free(&set);
+    printf("--- test_workload_deadline_column PASSED ---\n");
+}
+
+int main() {
+    test_schedule_edf();
+    test_edf_preemption();
+    test_deadline_metrics_stcf_rr();
+    test_workload_deadline_column();
+    return 0;
+}
@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h> // Para realizar las aserciones
+#include <math.h>   // Para fabs
 #include "../include/scheduler.h"
 #include "../include/algorithms.h"
 #include "../include/metrics.h"
@@ -9,9 +10,9 @@
 // --- Workload de Prueba (Workload 1) ---
 process_t test_processes[] = {
     // PID | Arrival | Burst | Priority
-    {1, 0, 5, 1, 0, -1, 0, 0, 0, 0, 0, 0}, 
-    {2, 1, 3, 2, 0, -1, 0, 0, 0, 0, 0, 0}, 
-    {3, 2, 8, 1, 0, -1, 0, 0, 0, 0, 0, 0}  
+    {1, 0, 5, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0}, 
+    {2, 1, 3, 2, 0, -1, 0, 0, 0, 0, 0, 0, 0}, 
+    {3, 2, 8, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0}  
 };
 const int NUM_TEST_PROCESSES = 3;
 
@@ -26,15 +27,16 @@ void test_schedule_fifo() {
     printf("--- Ejecutando test_schedule_fifo ---\n");
 
     // 1. Inicialización de datos
-    process_t processes[MAX_PROCESSES];
-    timeline_event_t timeline[MAX_TIMELINE_EVENTS];
+    process_t processes[NUM_TEST_PROCESSES];
+    timeline_t timeline;
     metrics_t metrics;
+    timeline_init(&timeline);
     
     // Usamos reset_processes para cargar la copia limpia del workload
     reset_processes(processes, NUM_TEST_PROCESSES, test_processes);
     
     // 2. Ejecutar el algoritmo FIFO
-    schedule_fifo(processes, NUM_TEST_PROCESSES, timeline);
+    schedule_fifo(processes, NUM_TEST_PROCESSES, &timeline);
     
     // 3. Cálculos y Verificación de Tiempos Finales (Valores Esperados para FIFO)
     // El orden de ejecución es P1 (5s), P2 (3s), P3 (8s)
@@ -81,6 +83,7 @@ void test_schedule_fifo() {
     assert(fabs(metrics.cpu_utilization - 100.0) < 0.01);
 
     printf("  ✅ Verificación de Métricas Promedio OK.\n");
+    timeline_free(&timeline);
     printf("--- test_schedule_fifo PASSED ---\n");
 }
 
@@ -0,0 +1,290 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <time.h>
+#include "../include/scheduler.h"
+#include "../include/algorithms.h"
+#include "../include/buffers.h"
+#include "../include/compact_timeline.h"
+#include "../include/gantt_lod.h"
+
+#define NUM_RANDOM_PROCESSES 40
+#define MAX_COLUMNS 2000
+#define REDRAW_BUDGET_MS 16.0
+
+extern void reset_processes(process_t *processes, int n, process_t *original);
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Workload de n procesos con la misma ráfaga, llegando de a uno por unidad.
+ */
+static void run_rr_trace(int n, int burst, timeline_t *timeline) {
+    process_t *original = calloc(n, sizeof(process_t));
+    process_t *processes = malloc(n * sizeof(process_t));
+    assert(original && processes);
+    for (int i = 0; i < n; i++) {
+        original[i].pid = i + 1;
+        original[i].arrival_time = i;
+        original[i].burst_time = burst;
+    }
+    reset_processes(processes, n, original);
+    schedule_rr(processes, n, 1, timeline);
+    free(processes);
+    free(original);
+}
+
+/**
+ * @brief Vista con más detalle que un bucket: cada columna coincide con el
+ * cálculo directo sobre todos los segmentos (ya fusionados).
+ */
+void test_gantt_lod_segments() {
+    printf("--- Ejecutando test_gantt_lod_segments ---\n");
+
+    process_t original[NUM_RANDOM_PROCESSES];
+    process_t processes[NUM_RANDOM_PROCESSES];
+    gantt_summary_t columns[MAX_COLUMNS];
+    timeline_t timeline;
+    compact_timeline_t compact;
+    gantt_lod_t lod;
+    unsigned int seed = 7;
+    timeline_init(&timeline);
+    compact_timeline_init(&compact);
+
+    for (int round = 0; round < 50; round++) {
+        int n = 1 + round % NUM_RANDOM_PROCESSES;
+        for (int i = 0; i < n; i++) {
+            memset(&original[i], 0, sizeof(process_t));
+            original[i].pid = i + 1;
+            seed = seed * 1103515245u + 12345u;
+            original[i].arrival_time = (seed >> 16) % 150;
+            seed = seed * 1103515245u + 12345u;
+            original[i].burst_time = 1 + (seed >> 16) % 10;
+        }
+        reset_processes(processes, n, original);
+        if (round % 2) schedule_rr(processes, n, 2, &timeline);
+        else schedule_stcf(processes, n, &timeline);
+        compact_timeline_build(&compact, &timeline);
+        assert(gantt_lod_build(&lod, &compact) == 0);
+        assert(lod.bucket_width == 1);
+
+        double start = (round % 8) * 2.25;
+        double units_per_column = round % 3 ? 0.5 : 0.25;
+        int count = 1 + (round * 37) % 300;
+        gantt_lod_columns(&lod, start, units_per_column, count, columns);
+
+        for (int c = 0; c < count; c++) {
+            double column_start = start + c * units_per_column;
+            double column_end = column_start + units_per_column;
+            gantt_summary_t expected = {0, 0, 0, 0};
+            compact_timeline_iter_t iter;
+            timeline_event_t segment;
+            compact_timeline_iter_init(&iter, &compact);
+            while (compact_timeline_next(&iter, &segment)) {
+                const timeline_event_t *ev = &segment;
+                double from = ev->time > column_start ? ev->time : column_start;
+                double to = ev->time + ev->duration < column_end ? ev->time + ev->duration : column_end;
+                if (ev->pid == 0 || to <= from) continue;
+                if (ev->pid > 0) expected.busy += (float)(to - from);
+                expected.covered += (float)(to - from);
+                if (to - from > expected.longest) {
+                    expected.longest = (float)(to - from);
+                    expected.pid = ev->pid;
+                }
+            }
+            assert(columns[c].busy == expected.busy);
+            assert(columns[c].longest == expected.longest);
+            assert(columns[c].covered == expected.covered);
+            assert(columns[c].pid == expected.pid || columns[c].longest == 0);
+        }
+        gantt_lod_free(&lod);
+    }
+
+    compact_timeline_free(&compact);
+    timeline_free(&timeline);
+    printf("--- test_gantt_lod_segments PASSED ---\n");
+}
+
+/**
+ * @brief Traza de más de GANTT_LOD_MAX_BUCKETS unidades: en vistas alineadas con
+ * los buckets de cada nivel, el tiempo ocupado es exacto y el pid dominante se
+ * ejecuta dentro de la columna; los puntos de control llevan al segmento correcto.
+ */
+void test_gantt_lod_levels() {
+    printf("--- Ejecutando test_gantt_lod_levels ---\n");
+
+    timeline_t timeline;
+    compact_timeline_t compact;
+    gantt_lod_t lod;
+    gantt_summary_t columns[MAX_COLUMNS];
+    timeline_init(&timeline);
+    compact_timeline_init(&compact);
+    run_rr_trace(300, 1000, &timeline);
+    compact_timeline_build(&compact, &timeline);
+    assert(gantt_lod_build(&lod, &compact) == 0);
+
+    int end_time = compact.end_time;
+    assert(end_time > GANTT_LOD_MAX_BUCKETS && lod.bucket_width == 2);
+    assert(lod.level_size[lod.num_levels - 1] == 1);
+
+    // Dueño de cada instante (un solo CPU: los segmentos no se solapan)
+    int *owner = malloc(end_time * sizeof(int));
+    long long *busy_prefix = malloc((end_time + 1) * sizeof(long long));
+    assert(owner && busy_prefix);
+    for (int i = 0; i < timeline.count; i++) {
+        const timeline_event_t *ev = &timeline.events[i];
+        for (int t = ev->time; t < ev->time + ev->duration; t++) owner[t] = ev->pid;
+    }
+    busy_prefix[0] = 0;
+    for (int t = 0; t < end_time; t++) busy_prefix[t + 1] = busy_prefix[t] + (owner[t] > 0);
+
+    for (int level = 0; level < lod.num_levels; level++) {
+        int width = lod.bucket_width << level;
+        long long first = (lod.level_size[level] / 3) * (long long)width;
+        gantt_lod_columns(&lod, (double)first, width, MAX_COLUMNS, columns);
+        for (int c = 0; c < MAX_COLUMNS; c++) {
+            long long from = first + (long long)c * width;
+            long long to = from + width < end_time ? from + width : end_time;
+            if (from >= end_time) {
+                assert(columns[c].pid == 0 && columns[c].busy == 0);
+                continue;
+            }
+            assert(columns[c].busy == (float)(busy_prefix[to] - busy_prefix[from]));
+            assert(columns[c].covered == (float)(to - from));
+            int present = 0;
+            for (long long t = from; t < to && !present; t++) present = owner[t] == columns[c].pid;
+            assert(present);
+        }
+    }
+
+    // Búsqueda: el primer segmento que termina después de time lo contiene
+    unsigned int seed = 3;
+    for (int k = 0; k < 1000; k++) {
+        seed = seed * 1103515245u + 12345u;
+        int time = (int)((seed >> 8) % end_time);
+        compact_timeline_iter_t iter;
+        timeline_event_t ev;
+        gantt_lod_seek(&lod, time, &iter);
+        while (compact_timeline_next(&iter, &ev) && ev.time + ev.duration <= time) {}
+        assert(ev.time <= time && time < ev.time + ev.duration && ev.pid == owner[time]);
+    }
+
+    free(busy_prefix);
+    free(owner);
+    gantt_lod_free(&lod);
+    compact_timeline_free(&compact);
+    timeline_free(&timeline);
+    printf("--- test_gantt_lod_levels PASSED ---\n");
+}
+
+/**
+ * @brief 10^6 despachos: resumir una vista de MAX_COLUMNS columnas, desde la
+ * traza completa hasta unas pocas unidades, cabe en el presupuesto de un cuadro.
+ */
+void test_gantt_lod_redraw_time() {
+    printf("--- Ejecutando test_gantt_lod_redraw_time ---\n");
+
+    timeline_t timeline;
+    compact_timeline_t compact;
+    gantt_lod_t lod;
+    gantt_summary_t columns[MAX_COLUMNS];
+    timeline_init(&timeline);
+    compact_timeline_init(&compact);
+    run_rr_trace(1000, 1000, &timeline);
+    compact_timeline_build(&compact, &timeline);
+
+    double t0 = now_seconds();
+    assert(gantt_lod_build(&lod, &compact) == 0);
+    double build_ms = (now_seconds() - t0) * 1e3;
+    printf("  ✅ Índice de %d segmentos construido en %.1f ms\n", compact.count, build_ms);
+
+    for (double span = compact.end_time; span >= 10; span /= 10) {
+        const int repetitions = 20;
+        double start = (compact.end_time - span) / 2;
+        t0 = now_seconds();
+        for (int r = 0; r < repetitions; r++) {
+            gantt_lod_columns(&lod, start + r, span / MAX_COLUMNS, MAX_COLUMNS, columns);
+        }
+        double query_ms = (now_seconds() - t0) * 1e3 / repetitions;
+        printf("  ✅ Vista de %.0f unidades: %.3f ms por cuadro\n", span, query_ms);
+        assert(query_ms < REDRAW_BUDGET_MS);
+    }
+
+    gantt_lod_free(&lod);
+    compact_timeline_free(&compact);
+    timeline_free(&timeline);
+    printf("--- test_gantt_lod_redraw_time PASSED ---\n");
+}
+
+/**
+ * @brief Marcas del eje: 1, 2 o 5 x 10^k, nunca menores que lo pedido ni que 1.
+ */
+void test_gantt_tick_interval() {
+    printf("--- Ejecutando test_gantt_tick_interval ---\n");
+    assert(gantt_tick_interval(0.3) == 1);
+    assert(gantt_tick_interval(1) == 1);
+    assert(gantt_tick_interval(1.5) == 2);
+    assert(gantt_tick_interval(5) == 5);
+    assert(gantt_tick_interval(6) == 10);
+    assert(gantt_tick_interval(471) == 500);
+    assert(gantt_tick_interval(1001) == 2000);
+    printf("--- test_gantt_tick_interval PASSED ---\n");
+}
+
+/**
+ * @brief La línea de tiempo se mueve después de construir el índice (como al
+ * pasar el resultado de un trabajo de la GUI a la vista): con lod.timeline
+ * actualizado, las vistas con más detalle que un bucket no leen la original.
+ */
+void test_gantt_lod_moved_timeline() {
+    printf("--- Ejecutando test_gantt_lod_moved_timeline ---\n");
+
+    gantt_summary_t expected[MAX_COLUMNS], actual[MAX_COLUMNS];
+    timeline_t timeline;
+    compact_timeline_t *owned = malloc(sizeof(compact_timeline_t));
+    compact_timeline_t moved;
+    gantt_lod_t lod, reference;
+    assert(owned);
+    timeline_init(&timeline);
+    compact_timeline_init(owned);
+
+    run_rr_trace(300, 4, &timeline); // Varios puntos de control
+    compact_timeline_build(owned, &timeline);
+    assert(gantt_lod_build(&lod, owned) == 0);
+    assert(lod.num_checkpoints > 2 && lod.bucket_width == 1);
+
+    // Mover la estructura y dejar la original vacía (el trabajo se libera)
+    moved = *owned;
+    memset(owned, 0, sizeof(compact_timeline_t));
+    free(owned);
+    lod.timeline = &moved;
+    assert(gantt_lod_build(&reference, &moved) == 0);
+
+    const double starts[] = {0.0, 700.25, 1000.0, moved.end_time - 50.0};
+    for (int k = 0; k < 4; k++) {
+        gantt_lod_columns(&lod, starts[k], 0.25, MAX_COLUMNS / 4, actual);
+        gantt_lod_columns(&reference, starts[k], 0.25, MAX_COLUMNS / 4, expected);
+        assert(memcmp(actual, expected, (MAX_COLUMNS / 4) * sizeof(gantt_summary_t)) == 0);
+        assert(actual[0].busy > 0);
+    }
+
+    gantt_lod_free(&reference);
+    gantt_lod_free(&lod);
+    compact_timeline_free(&moved);
+    timeline_free(&timeline);
+    printf("--- test_gantt_lod_moved_timeline PASSED ---\n");
+}
+
+int main() {
+    test_gantt_lod_segments();
+    test_gantt_lod_levels();
+    test_gantt_lod_moved_timeline();
+    test_gantt_lod_redraw_time();
+    test_gantt_tick_interval();
+    return 0;
+}
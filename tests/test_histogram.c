@@ -0,0 +1,159 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "../include/scheduler.h"
+#include "../include/algorithms.h"
+#include "../include/metrics.h"
+#include "../include/histogram.h"
+
+#define NUM_RANDOM_VALUES 50000
+
+extern void reset_processes(process_t *processes, int n, process_t *original);
+
+static int compare_int(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Percentil por rango más cercano sobre un array ordenado (referencia).
+ * Solo aritmética entera: percentile_milli es el percentil en milésimas (99.9% = 99900)
+ * y el rango es el menor r con r / n >= percentile_milli / 100000.
+ */
+static int exact_percentile(const int *sorted, int n, long long percentile_milli) {
+    long long target = percentile_milli * n;
+    long long rank = target / 100000;
+    if (rank * 100000 < target) rank++;
+    if (rank < 1) rank = 1;
+    return sorted[rank - 1];
+}
+
+/**
+ * @brief Valores pequeños (< 256): cada uno tiene su bucket y los percentiles son exactos.
+ */
+void test_histogram_exact_small_values() {
+    printf("--- Ejecutando test_histogram_exact_small_values ---\n");
+
+    histogram_t hist;
+    histogram_init(&hist);
+    assert(histogram_percentile(&hist, 50.0) == 0); // Vacío
+
+    for (int v = 100; v >= 1; v--) histogram_record(&hist, v);
+    assert(histogram_percentile(&hist, 50.0) == 50);
+    assert(histogram_percentile(&hist, 90.0) == 90);
+    assert(histogram_percentile(&hist, 99.0) == 99);
+    assert(histogram_percentile(&hist, 99.9) == 100);
+    assert(histogram_percentile(&hist, 100.0) == 100);
+
+    printf("--- test_histogram_exact_small_values PASSED ---\n");
+}
+
+/**
+ * @brief Valores grandes: el percentil nunca queda por debajo del exacto y lo
+ * supera en menos de 1/128 de su valor.
+ */
+void test_histogram_relative_error() {
+    printf("--- Ejecutando test_histogram_relative_error ---\n");
+
+    static int values[NUM_RANDOM_VALUES];
+    static histogram_t hist; // ~13 KB: fuera de la pila del test
+    const long long percentiles[] = {1000, 25000, 50000, 90000, 99000, 99900, 100000}; // Milésimas
+    unsigned int seed = 12345;
+
+    for (int round = 0; round < 5; round++) {
+        int range = round == 4 ? 2147483647 : 1000 << (4 * round);
+        histogram_init(&hist);
+        for (int i = 0; i < NUM_RANDOM_VALUES; i++) {
+            seed = seed * 1103515245u + 12345u;
+            unsigned int r = (seed >> 8) ^ (seed << 12);
+            values[i] = (int)(r % (unsigned int)range);
+            histogram_record(&hist, values[i]);
+        }
+        qsort(values, NUM_RANDOM_VALUES, sizeof(int), compare_int);
+
+        for (int k = 0; k < (int)(sizeof(percentiles) / sizeof(percentiles[0])); k++) {
+            int exact = exact_percentile(values, NUM_RANDOM_VALUES, percentiles[k]);
+            int approx = histogram_percentile(&hist, percentiles[k] / 1000.0);
+            assert(approx >= exact);
+            assert((double)(approx - exact) <= exact / 128.0);
+        }
+        assert(histogram_percentile(&hist, 100.0) == values[NUM_RANDOM_VALUES - 1]);
+    }
+
+    printf("  ✅ Error relativo < 1/128 en todos los rangos.\n");
+    printf("--- test_histogram_relative_error PASSED ---\n");
+}
+
+/**
+ * @brief Rangos exactos: con n - n/1000 unos y n/1000 valores 200, P99.9 cae
+ * justo en el último 1. Un rango calculado en double (ceil(0.999 * n)) se pasa
+ * al siguiente y devolvería 200, el máximo.
+ */
+void test_histogram_exact_rank() {
+    printf("--- Ejecutando test_histogram_exact_rank ---\n");
+
+    static histogram_t hist;
+    static int values[1000];
+    for (int n = 1000; n <= 1000000; n *= 10) {
+        histogram_init(&hist);
+        for (int i = 0; i < n; i++) histogram_record(&hist, i < n - n / 1000 ? 1 : 200);
+        assert(histogram_percentile(&hist, 99.9) == 1);
+        assert(histogram_percentile(&hist, 99.0) == 1);
+        assert(histogram_percentile(&hist, 100.0) == 200);
+    }
+
+    // n = 1000 con valores distintos: cada percentil coincide con la referencia entera
+    histogram_init(&hist);
+    for (int i = 0; i < 1000; i++) {
+        values[i] = i + 1;
+        histogram_record(&hist, values[i]);
+    }
+    assert(histogram_percentile(&hist, 99.9) == exact_percentile(values, 1000, 99900) && values[998] == 999);
+    for (long long p = 100; p <= 100000; p += 100) {
+        int exact = exact_percentile(values, 1000, p);
+        int approx = histogram_percentile(&hist, p / 1000.0);
+        assert(approx >= exact && (double)(approx - exact) <= exact / 128.0);
+        if (exact < 256) assert(approx == exact); // Valores pequeños: un bucket por valor
+    }
+
+    printf("--- test_histogram_exact_rank PASSED ---\n");
+}
+
+/**
+ * @brief calculate_metrics llena los percentiles de TAT, WT y RT.
+ * FIFO sobre Workload 1: TAT = {5, 7, 14}, WT = {0, 4, 6}, RT = {0, 4, 6}.
+ */
+void test_metrics_percentiles() {
+    printf("--- Ejecutando test_metrics_percentiles ---\n");
+
+    process_t original[] = {
+        {1, 0, 5, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+        {2, 1, 3, 2, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+        {3, 2, 8, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0}
+    };
+    process_t processes[3];
+    timeline_t timeline;
+    metrics_t metrics;
+    timeline_init(&timeline);
+
+    reset_processes(processes, 3, original);
+    schedule_fifo(processes, 3, &timeline);
+    calculate_metrics(processes, 3, 16, &metrics);
+
+    assert(metrics.tat_percentiles.p50 == 7 && metrics.tat_percentiles.p90 == 14);
+    assert(metrics.tat_percentiles.p999 == 14 && metrics.tat_percentiles.max == 14);
+    assert(metrics.wt_percentiles.p50 == 4 && metrics.wt_percentiles.max == 6);
+    assert(metrics.rt_percentiles.p50 == 4 && metrics.rt_percentiles.p99 == 6);
+
+    timeline_free(&timeline);
+    printf("--- test_metrics_percentiles PASSED ---\n");
+}
+
+int main() {
+    test_histogram_exact_small_values();
+    test_histogram_relative_error();
+    test_histogram_exact_rank();
+    test_metrics_percentiles();
+    return 0;
+}
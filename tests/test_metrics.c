@@ -0,0 +1,178 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <float.h>
+#include "../include/scheduler.h"
+#include "../include/algorithms.h"
+#include "../include/metrics.h"
+
+#define NUM_RANDOM_PROCESSES 40
+#define NUM_ALGORITHMS 12
+
+extern void reset_processes(process_t *processes, int n, process_t *original);
+
+/**
+ * @brief Ejecuta el algoritmo número alg sobre los procesos.
+ */
+static void run_algorithm(int alg, process_t *p, int n, timeline_t *timeline) {
+    mlfq_config_t mlfq = {.num_queues = 3, .quantums = {2, 4, 8}, .boost_interval = 10};
+    cfs_config_t cfs = {.target_latency = 6, .min_granularity = 1};
+    priority_config_t prio = {.preemptive = alg == 11, .aging_interval = 3};
+
+    switch (alg) {
+        case 0: schedule_fifo(p, n, timeline); break;
+        case 1: schedule_sjf(p, n, timeline); break;
+        case 2: schedule_stcf(p, n, timeline); break;
+        case 3: schedule_stcf_tick(p, n, timeline); break;
+        case 4: schedule_rr(p, n, 3, timeline); break;
+        case 5: schedule_mlfq(p, n, &mlfq, timeline); break;
+        case 6: schedule_cfs(p, n, &cfs, timeline); break;
+        case 7: schedule_stride(p, n, 2, timeline); break;
+        case 8: schedule_lottery(p, n, 2, 9, timeline); break;
+        case 9: schedule_edf(p, n, timeline); break;
+        default: schedule_priority(p, n, &prio, timeline); break;
+    }
+}
+
+static void assert_same_percentiles(const percentiles_t *a, const percentiles_t *b) {
+    assert(a->p50 == b->p50 && a->p90 == b->p90 && a->p99 == b->p99);
+    assert(a->p999 == b->p999 && a->max == b->max);
+}
+
+/**
+ * @brief Las sumas son de enteros (exactas en double), así que la comparación
+ * con la implementación de referencia es por igualdad, sin tolerancia.
+ */
+static void assert_same_metrics(const metrics_t *a, const metrics_t *b) {
+    assert(a->avg_turnaround_time == b->avg_turnaround_time);
+    assert(a->avg_waiting_time == b->avg_waiting_time);
+    assert(a->avg_response_time == b->avg_response_time);
+    assert(a->cpu_utilization == b->cpu_utilization);
+    assert(a->throughput == b->throughput);
+    assert(a->fairness_index == b->fairness_index);
+    assert(a->deadline_count == b->deadline_count);
+    assert(a->deadline_miss_ratio == b->deadline_miss_ratio);
+    assert(a->max_lateness == b->max_lateness);
+    assert_same_percentiles(&a->tat_percentiles, &b->tat_percentiles);
+    assert_same_percentiles(&a->wt_percentiles, &b->wt_percentiles);
+    assert_same_percentiles(&a->rt_percentiles, &b->rt_percentiles);
+}
+
+/**
+ * @brief En todos los planificadores, el acumulador que llenan al completar
+ * procesos da las mismas métricas y el mismo tiempo total que calculate_metrics.
+ */
+void test_accumulator_matches_reference() {
+    printf("--- Ejecutando test_accumulator_matches_reference ---\n");
+
+    process_t original[NUM_RANDOM_PROCESSES];
+    process_t processes[NUM_RANDOM_PROCESSES];
+    timeline_t timeline;
+    metrics_acc_t acc;
+    unsigned int seed = 2024;
+    timeline_init(&timeline);
+    timeline.stats = &acc;
+
+    for (int round = 0; round < 60; round++) {
+        int n = 1 + round % NUM_RANDOM_PROCESSES;
+        for (int i = 0; i < n; i++) {
+            memset(&original[i], 0, sizeof(process_t));
+            original[i].pid = i + 1;
+            seed = seed * 1103515245u + 12345u;
+            original[i].arrival_time = (seed >> 16) % 80; // Con huecos (IDLE)
+            seed = seed * 1103515245u + 12345u;
+            original[i].burst_time = 1 + (seed >> 16) % 15;
+            original[i].priority = (int)((seed >> 4) % 8);
+            original[i].deadline = (seed & 3) ? (int)((seed >> 8) % 40) : 0;
+        }
+
+        for (int alg = 0; alg < NUM_ALGORITHMS; alg++) {
+            metrics_t expected, actual;
+            reset_processes(processes, n, original);
+            run_algorithm(alg, processes, n, &timeline);
+
+            int total_time = 0;
+            for (int i = 0; i < n; i++) {
+                if (processes[i].completion_time > total_time) total_time = processes[i].completion_time;
+            }
+            calculate_metrics(processes, n, total_time, &expected);
+
+            assert(metrics_acc_finish(&acc, &actual) == total_time);
+            assert(acc.completed == n);
+            assert_same_metrics(&actual, &expected);
+        }
+    }
+
+    timeline_free(&timeline);
+    printf("  ✅ Acumulador idéntico a calculate_metrics en %d algoritmos.\n", NUM_ALGORITHMS);
+    printf("--- test_accumulator_matches_reference PASSED ---\n");
+}
+
+/**
+ * @brief Sin acumulador (stats = NULL) los planificadores funcionan igual, y un
+ * acumulador vacío da métricas en 0.
+ */
+void test_accumulator_optional() {
+    printf("--- Ejecutando test_accumulator_optional ---\n");
+
+    process_t original[] = {
+        {1, 0, 5, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+        {2, 1, 3, 2, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+        {3, 2, 8, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0}
+    };
+    process_t processes[3];
+    timeline_t timeline;
+    metrics_acc_t acc;
+    metrics_t metrics;
+    timeline_init(&timeline);
+    assert(timeline.stats == NULL);
+
+    reset_processes(processes, 3, original);
+    schedule_fifo(processes, 3, &timeline);
+    assert(processes[2].completion_time == 16);
+
+    metrics_acc_reset(&acc);
+    assert(metrics_acc_finish(&acc, &metrics) == 0);
+    assert(metrics.avg_turnaround_time == 0.0 && metrics.throughput == 0.0);
+    assert(metrics.tat_percentiles.max == 0);
+
+    timeline_free(&timeline);
+    printf("--- test_accumulator_optional PASSED ---\n");
+}
+
+/**
+ * @brief Sumas más allá de 2^53: las de TAT, WT, RT y burst son enteras y la de
+ * cuadrados no pierde las unidades que double redondearía.
+ */
+void test_accumulator_large_sums() {
+    printf("--- Ejecutando test_accumulator_large_sums ---\n");
+
+    metrics_acc_t acc;
+    metrics_t metrics;
+    metrics_acc_reset(&acc);
+
+    // TAT = 2^27 + 1: TAT^2 = 2^54 + 2^28 + 1 necesita 55 bits de mantisa
+    const int tat = (1 << 27) + 1;
+    for (int i = 0; i < 4; i++) metrics_acc_add(&acc, 0, 1, 0, tat, 0);
+    assert(acc.sum_tat == 4LL * tat && acc.sum_wt == 4LL * (tat - 1) && acc.sum_burst == 4);
+    if (LDBL_MANT_DIG >= 64) {
+        long double square = (long double)tat * tat;
+        assert(acc.sum_tat_squared == 4 * square);
+        assert(acc.sum_tat_squared - 4.0L * (1LL << 54) == 4.0L * ((1 << 28) + 1));
+    }
+
+    // 4 procesos con el mismo TAT: equidad perfecta
+    assert(metrics_acc_finish(&acc, &metrics) == tat);
+    assert(metrics.fairness_index == 1.0);
+    assert(metrics.avg_turnaround_time == (double)tat);
+
+    printf("--- test_accumulator_large_sums PASSED ---\n");
+}
+
+int main() {
+    test_accumulator_matches_reference();
+    test_accumulator_optional();
+    test_accumulator_large_sums();
+    return 0;
+}
@@ -14,8 +14,8 @@
 
 process_t test_processes[] = {
     // PID | Arrival | Burst | Priority | Rem | Start | Comp | TAT | WT | RT
-    {1, 0, 15, 1, 0, -1, 0, 0, 0, 0, 0, 0}, 
-    {2, 1, 2, 1, 0, -1, 0, 0, 0, 0, 0, 0}
+    {1, 0, 15, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0}, 
+    {2, 1, 2, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0}
 };
 const int NUM_TEST_PROCESSES = 2;
 
@@ -29,43 +29,44 @@ void test_schedule_mlfq() {
     printf("--- Ejecutando test_schedule_mlfq ---\n");
 
     // 1. Configuración de MLFQ
-    int mlfq_quantums[] = {2, 4, 8}; // Q0=2, Q1=4, Q2=8
     mlfq_config_t config = {
         .num_queues = 3,
-        .quantums = mlfq_quantums,
+        .quantums = {2, 4, 8}, // Q0=2, Q1=4, Q2=8
         .boost_interval = 10 // El boost ocurre en T=10, T=20, etc.
     };
 
     // 2. Inicialización de datos
-    process_t processes[MAX_PROCESSES];
-    timeline_event_t timeline[MAX_TIMELINE_EVENTS];
+    process_t processes[NUM_TEST_PROCESSES];
+    timeline_t timeline;
     metrics_t metrics;
+    timeline_init(&timeline);
     
     reset_processes(processes, NUM_TEST_PROCESSES, test_processes);
     
     // 3. Ejecutar el algoritmo MLFQ
-    schedule_mlfq(processes, NUM_TEST_PROCESSES, &config, timeline);
+    schedule_mlfq(processes, NUM_TEST_PROCESSES, &config, &timeline);
     
     // 4. Verificación de Tiempos Finales (Valores Esperados para MLFQ)
     
-    // Simulación Detallada (Burst P1=15, P2=2. Q0=2, Q1=4. Boost=10):
-    // T=0: P1 (15) en Q0.
-    // T=0-1: P1 ejecuta 1s (Rem=14).
-    // T=1: P2 (2) llega. P2 entra en Q0 y preempta a P1.
+    // Simulación Detallada (Burst P1=15, P2=2. Q0=2, Q1=4, Q2=8. Boost=10):
+    // T=0-1: P1 ejecuta en Q0 (Rem=14, usó 1 de su quantum).
+    // T=1: P2 llega, entra en Q0 antes que P1 y lo desaloja (P1 conserva el tiempo usado).
     // T=1-3: P2 ejecuta 2s (Quantum Q0=2). P2 termina en T=3.
-    // T=3: P1 entra en Q0 (Rem=14). P1 ejecuta 2s (Quantum Q0).
-    // T=5: P1 preempta y DEGRADA a Q1 (Rem=12). P1 ejecuta 4s (Quantum Q1).
-    // T=9: P1 preempta y DEGRADA a Q2 (Rem=8). P1 ejecuta 1s (Boost en T=10).
-    // T=10: *** PRIORITY BOOST *** P1 se mueve de Q2 a Q0.
-    // T=10-12: P1 ejecuta 2s (Quantum Q0). P1 preempta y DEGRADA a Q1 (Rem=6).
-    // T=12-16: P1 ejecuta 4s (Quantum Q1). P1 preempta y DEGRADA a Q2 (Rem=2).
-    // T=16-18: P1 ejecuta 2s (Q2 no tiene quantum límite en este ejemplo, asume el resto). P1 termina.
-    // Total Time = 18.
+    // T=3-4: P1 completa su quantum de Q0 (Rem=13) y DEGRADA a Q1.
+    // T=4-8: P1 ejecuta 4s (Quantum Q1, Rem=9) y DEGRADA a Q2.
+    // T=8-10: P1 ejecuta 2s en Q2 (Rem=7).
+    // T=10: *** PRIORITY BOOST *** P1 se mueve de Q2 a Q0 (el boost no consume tiempo).
+    // T=10-12: P1 ejecuta 2s (Quantum Q0, Rem=5) y DEGRADA a Q1.
+    // T=12-16: P1 ejecuta 4s (Quantum Q1, Rem=1) y DEGRADA a Q2.
+    // T=16-17: P1 ejecuta 1s en Q2. P1 termina.
+    // Total Time = 17 (la CPU nunca está ociosa).
+    // Nota: la versión anterior de esta prueba esperaba T=18, lo que solo cuadra si
+    // el boost dejara la CPU ociosa una unidad; el modelo no tiene ese costo.
     
     // P1 (PID 1, Burst 15, Arrivo 0):
-    // Start=0, Completion=18. TAT=18. WT=3. RT=0.
+    // Start=0, Completion=17. TAT=17. WT=2. RT=0.
     assert(processes[0].start_time == 0);
-    assert(processes[0].completion_time == 18);
+    assert(processes[0].completion_time == 17);
     
     // P2 (PID 2, Burst 2, Arrivo 1):
     // Start=1, Completion=3. TAT=2. WT=0. RT=0. (1-1=0)
@@ -75,44 +76,27 @@ void test_schedule_mlfq() {
     printf("  ✅ Verificación de Tiempos de Completación (Start/Completion) OK.\n");
 
     // 5. Calcular métricas
-    int total_time = 18; // El tiempo total es 18
+    int total_time = 17; // El tiempo total es 17
     calculate_metrics(processes, NUM_TEST_PROCESSES, total_time, &metrics);
 
     // 6. Verificación de Métricas (Valores Esperados para MLFQ)
     
-    // P1: TAT=18, WT=3, RT=0
+    // P1: TAT=17, WT=2, RT=0
     // P2: TAT=2, WT=0, RT=0
-    // Total TAT = 20. Avg TAT = 20 / 2 = 10.0
-    assert(fabs(metrics.avg_turnaround_time - 10.0) < 0.01);
+    // Total TAT = 19. Avg TAT = 19 / 2 = 9.5
+    assert(fabs(metrics.avg_turnaround_time - 9.5) < 0.01);
 
-    // Total WT = 3. Avg WT = 3 / 2 = 1.5
-    assert(fabs(metrics.avg_waiting_time - 1.5) < 0.01);
+    // Total WT = 2. Avg WT = 2 / 2 = 1.0
+    assert(fabs(metrics.avg_waiting_time - 1.0) < 0.01);
     
     // Total RT = 0. Avg RT = 0.0
     assert(fabs(metrics.avg_response_time - 0.0) < 0.01);
     
-    // CPU Utilization: Total Burst (17) / Total Time (18) = 94.44%
-    // NOTA: Si la simulación NO termina en el tiempo de ráfaga total, la utilización es menor a 100%.
-    // En este caso, el tiempo total es 18, y el burst total es 17 (15+2).
-    // Si la simulación termina exactamente en T=17, la utilización es 100%.
-    // Asumiremos que termina en T=17 (el último proceso termina su ráfaga).
-    // Recalculando: Si P1 termina en T=17 (10-12, 12-16, 16-17), el total es 17.
+    // CPU Utilization: Total Burst (17) / Total Time (17) = 100%
+    assert(fabs(metrics.cpu_utilization - 100.0) < 0.01);
     
-    // Vamos a asumir que la simulación termina en T=17 (si la lógica es perfecta).
-    total_time = 17;
-    // P1: Start=0, Completion=17. TAT=17. WT=2.
-    // P2: Start=1, Completion=3. TAT=2. WT=0.
-    
-    // Recalcular métricas con T=17:
-    // Total TAT = 19. Avg TAT = 9.5
-    // Total WT = 2. Avg WT = 1.0
-    // CPU Util = 17/17 = 100%.
-
-    // *** Usando los valores de la primera simulación para mayor seguridad (T=18) ***
-    // CPU Utilization: Total Burst (17) / Total Time (18) ≈ 94.44%
-    // assert(fabs(metrics.cpu_utilization - 94.44) < 0.01); // Se debe re-ejecutar calculate_metrics
-    
-    printf("  ✅ Verificación de Métricas Promedio OK. (Nota: Se requiere verificar la precisión de la lógica MLFQ).\n");
+    printf("  ✅ Verificación de Métricas Promedio OK.\n");
+    timeline_free(&timeline);
     printf("--- test_schedule_mlfq PASSED (Lógica general validada) ---\n");
 }
 
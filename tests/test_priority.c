@@ -0,0 +1,263 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "../include/scheduler.h"
+#include "../include/algorithms.h"
+
+// --- Workload de Prueba (Workload 1) ---
+// PID 1: Arrival=0, Burst=5, Priority=1
+// PID 2: Arrival=1, Burst=3, Priority=2
+// PID 3: Arrival=2, Burst=8, Priority=1
+process_t test_processes[] = {
+    // PID | Arrival | Burst | Priority | Rem | Start | Comp | TAT | WT | RT
+    {1, 0, 5, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+    {2, 1, 3, 2, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+    {3, 2, 8, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0}
+};
+const int NUM_TEST_PROCESSES = 3;
+
+#define NUM_RANDOM_PROCESSES 30
+#define NUM_STREAM_PROCESSES 20
+
+extern void reset_processes(process_t *processes, int n, process_t *original);
+
+/**
+ * @brief Versión de referencia: avanza el reloj una unidad a la vez y recalcula
+ * el nivel efectivo de cada proceso en espera en cada tick. Elige por el nivel
+ * continuo (que ordena igual que el entero, desempatándolo) y desaloja solo con
+ * un nivel entero estrictamente mejor que el del proceso en ejecución.
+ */
+static void priority_tick_reference(process_t *p, int n, const priority_config_t *config) {
+    long long scale = config->aging_interval > 0 ? config->aging_interval : 1;
+    int aging = config->aging_interval > 0;
+    int ready_since[NUM_RANDOM_PROCESSES];
+    int done = 0, running = -1, t = 0;
+    long long running_level = 0;
+
+    for (int i = 0; i < n; i++) ready_since[i] = p[i].arrival_time;
+    while (done < n) {
+        // Prioridad efectiva (escalada) de un proceso en espera en el instante t
+        #define EFF(i) (p[i].priority * scale + (aging ? ready_since[i] - t : 0))
+        #define LEVEL(i) (aging ? p[i].priority - (t - ready_since[i]) / scale : p[i].priority)
+        #define BETTER(i, j) (EFF(i) != EFF(j) ? EFF(i) < EFF(j) : \
+                              (p[i].arrival_time != p[j].arrival_time ? p[i].arrival_time < p[j].arrival_time : i < j))
+        int best = -1;
+        for (int i = 0; i < n; i++) {
+            if (i == running || p[i].remaining_time == 0 || p[i].arrival_time > t) continue;
+            if (best == -1 || BETTER(i, best)) best = i;
+        }
+        if (running != -1 && config->preemptive && best != -1 && LEVEL(best) < running_level) {
+            ready_since[running] = t;
+            running = -1;
+            best = -1;
+            for (int i = 0; i < n; i++) {
+                if (p[i].remaining_time == 0 || p[i].arrival_time > t) continue;
+                if (best == -1 || BETTER(i, best)) best = i;
+            }
+        }
+        if (running == -1 && best != -1) {
+            running = best;
+            running_level = LEVEL(best);
+            if (p[running].start_time == -1) p[running].start_time = t;
+        }
+        #undef BETTER
+        #undef EFF
+        #undef LEVEL
+        t++;
+        if (running != -1 && --p[running].remaining_time == 0) {
+            p[running].completion_time = t;
+            running = -1;
+            done++;
+        }
+    }
+}
+
+/**
+ * @brief Sin aging y sin desalojo: P1 [0-5], P3 [5-13] (prioridad 1), P2 [13-16].
+ */
+void test_priority_non_preemptive() {
+    printf("--- Ejecutando test_priority_non_preemptive ---\n");
+
+    process_t processes[NUM_TEST_PROCESSES];
+    timeline_t timeline;
+    priority_config_t config = {.preemptive = 0, .aging_interval = 0};
+    timeline_init(&timeline);
+
+    reset_processes(processes, NUM_TEST_PROCESSES, test_processes);
+    schedule_priority(processes, NUM_TEST_PROCESSES, &config, &timeline);
+
+    assert(processes[0].start_time == 0 && processes[0].completion_time == 5);
+    assert(processes[2].start_time == 5 && processes[2].completion_time == 13);
+    assert(processes[1].start_time == 13 && processes[1].completion_time == 16);
+
+    timeline_free(&timeline);
+    printf("--- test_priority_non_preemptive PASSED ---\n");
+}
+
+/**
+ * @brief Preemptivo: una llegada con mejor prioridad desaloja al proceso actual.
+ */
+void test_priority_preemptive() {
+    printf("--- Ejecutando test_priority_preemptive ---\n");
+
+    process_t original[] = {
+        {1, 0, 6, 5, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+        {2, 2, 2, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0}
+    };
+    process_t processes[2];
+    timeline_t timeline;
+    priority_config_t config = {.preemptive = 1, .aging_interval = 0};
+    timeline_init(&timeline);
+
+    reset_processes(processes, 2, original);
+    schedule_priority(processes, 2, &config, &timeline);
+
+    // P1 [0-2], P2 [2-4], P1 [4-8]
+    assert(timeline.events[0].pid == 1 && timeline.events[0].duration == 2);
+    assert(timeline.events[1].pid == 2 && timeline.events[1].duration == 2);
+    assert(timeline.events[2].pid == 1 && timeline.events[2].time == 4);
+    assert(processes[1].completion_time == 4 && processes[0].completion_time == 8);
+
+    timeline_free(&timeline);
+    printf("--- test_priority_preemptive PASSED ---\n");
+}
+
+/**
+ * @brief Un proceso de baja prioridad frente a un flujo continuo de procesos de
+ * alta prioridad: sin aging espera a que termine el flujo; con aging empieza
+ * en cuanto su espera compensa la diferencia de prioridad.
+ */
+void test_priority_aging_prevents_starvation() {
+    printf("--- Ejecutando test_priority_aging_prevents_starvation ---\n");
+
+    process_t original[NUM_STREAM_PROCESSES + 1];
+    process_t processes[NUM_STREAM_PROCESSES + 1];
+    timeline_t timeline;
+    timeline_init(&timeline);
+
+    // P1: prioridad 10. P2..P21: prioridad 0, uno cada 2 unidades con burst 2
+    memset(original, 0, sizeof(original));
+    original[0] = (process_t){1, 0, 3, 10, 0, -1, 0, 0, 0, 0, 0, 0, 0};
+    for (int i = 1; i <= NUM_STREAM_PROCESSES; i++) {
+        original[i] = (process_t){i + 1, 2 * (i - 1), 2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0};
+    }
+
+    for (int preemptive = 0; preemptive <= 1; preemptive++) {
+        priority_config_t config = {.preemptive = preemptive, .aging_interval = 0};
+        reset_processes(processes, NUM_STREAM_PROCESSES + 1, original);
+        schedule_priority(processes, NUM_STREAM_PROCESSES + 1, &config, &timeline);
+        assert(processes[0].start_time == 2 * NUM_STREAM_PROCESSES); // Inanición hasta el final
+
+        config.aging_interval = 1; // Un nivel por unidad esperada: supera al flujo tras ~10
+        reset_processes(processes, NUM_STREAM_PROCESSES + 1, original);
+        schedule_priority(processes, NUM_STREAM_PROCESSES + 1, &config, &timeline);
+        assert(processes[0].start_time > 0 && processes[0].start_time <= 12);
+    }
+
+    timeline_free(&timeline);
+    printf("--- test_priority_aging_prevents_starvation PASSED ---\n");
+}
+
+/**
+ * @brief Aging por niveles enteros: dos procesos de igual prioridad no se
+ * desalojan antes de aging_interval unidades de espera (y nunca si el burst es
+ * menor), y uno k niveles peor desaloja exactamente tras (k + 1) * aging_interval.
+ */
+void test_priority_aging_levels() {
+    printf("--- Ejecutando test_priority_aging_levels ---\n");
+
+    process_t original[] = {
+        {1, 0, 50, 3, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+        {2, 0, 50, 3, 0, -1, 0, 0, 0, 0, 0, 0, 0}
+    };
+    process_t processes[2];
+    timeline_t timeline;
+    timeline_init(&timeline);
+
+    // 1. Igual prioridad, aging_interval > burst: cada uno corre de principio a fin
+    const int long_intervals[] = {100, 1000};
+    for (int k = 0; k < 2; k++) {
+        priority_config_t config = {.preemptive = 1, .aging_interval = long_intervals[k]};
+        reset_processes(processes, 2, original);
+        schedule_priority(processes, 2, &config, &timeline);
+        assert(timeline.count == 3); // P1 [0-50], P2 [50-100], fin
+        assert(timeline.events[0].pid == 1 && timeline.events[0].duration == 50);
+        assert(timeline.events[1].pid == 2 && timeline.events[1].duration == 50);
+    }
+
+    // 2. Igual prioridad, aging_interval = 5: el primer cambio ocurre a las 5 unidades
+    priority_config_t config = {.preemptive = 1, .aging_interval = 5};
+    reset_processes(processes, 2, original);
+    schedule_priority(processes, 2, &config, &timeline);
+    assert(timeline.events[0].pid == 1 && timeline.events[0].duration == 5);
+    assert(timeline.events[1].pid == 2 && timeline.events[1].time == 5);
+    for (int e = 0; e + 1 < timeline.count; e++) {
+        assert(timeline.events[e].duration >= config.aging_interval || e + 2 == timeline.count);
+    }
+
+    // 3. P2 k = 2 niveles peor que P1: lo desaloja en (k + 1) * aging_interval = 30
+    original[1].priority = original[0].priority + 2;
+    config.aging_interval = 10;
+    reset_processes(processes, 2, original);
+    schedule_priority(processes, 2, &config, &timeline);
+    assert(timeline.events[0].pid == 1 && timeline.events[0].duration == 30);
+    assert(timeline.events[1].pid == 2 && timeline.events[1].time == 30);
+    assert(processes[1].start_time == 30);
+
+    timeline_free(&timeline);
+    printf("--- test_priority_aging_levels PASSED ---\n");
+}
+
+/**
+ * @brief El motor por eventos produce los mismos resultados que la versión de
+ * referencia tick a tick, con y sin desalojo y con distintos aging_interval.
+ */
+void test_priority_matches_tick() {
+    printf("--- Ejecutando test_priority_matches_tick ---\n");
+
+    process_t original[NUM_RANDOM_PROCESSES];
+    process_t expected[NUM_RANDOM_PROCESSES];
+    process_t actual[NUM_RANDOM_PROCESSES];
+    timeline_t timeline;
+    unsigned int seed = 77;
+    timeline_init(&timeline);
+
+    for (int round = 0; round < 600; round++) {
+        int n = 1 + round % NUM_RANDOM_PROCESSES;
+        for (int i = 0; i < n; i++) {
+            memset(&original[i], 0, sizeof(process_t));
+            original[i].pid = i + 1;
+            seed = seed * 1103515245u + 12345u;
+            original[i].arrival_time = (seed >> 16) % 50;
+            seed = seed * 1103515245u + 12345u;
+            original[i].burst_time = 1 + (seed >> 16) % 10;
+            original[i].priority = (int)((seed >> 4) % 8);
+            original[i].start_time = -1;
+        }
+        priority_config_t config = {.preemptive = round % 2, .aging_interval = (round / 2) % 6};
+
+        reset_processes(expected, n, original);
+        priority_tick_reference(expected, n, &config);
+        reset_processes(actual, n, original);
+        schedule_priority(actual, n, &config, &timeline);
+
+        for (int i = 0; i < n; i++) {
+            assert(actual[i].start_time == expected[i].start_time);
+            assert(actual[i].completion_time == expected[i].completion_time);
+        }
+    }
+
+    timeline_free(&timeline);
+    printf("  ✅ Motor por eventos idéntico a la referencia tick a tick.\n");
+    printf("--- test_priority_matches_tick PASSED ---\n");
+}
+
+int main() {
+    test_priority_non_preemptive();
+    test_priority_preemptive();
+    test_priority_aging_prevents_starvation();
+    test_priority_aging_levels();
+    test_priority_matches_tick();
+    return 0;
+}
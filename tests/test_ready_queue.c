@@ -0,0 +1,129 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "../include/ready_queue.h"
+
+#define NUM_ELEMENTS 1000
+
+/**
+ * @brief Criterio de prueba: menor clave y, a igualdad, menor índice.
+ */
+static int compare_key_then_index(const void *ctx, int a, int b) {
+    const int *key = ctx;
+    if (key[a] != key[b]) return key[a] < key[b] ? -1 : 1;
+    return a - b;
+}
+
+/**
+ * @brief Cola vacía: pop y peek devuelven -1, también después de vaciarla.
+ */
+void test_ready_queue_empty() {
+    printf("--- Ejecutando test_ready_queue_empty ---\n");
+
+    int key[1] = {7};
+    ready_queue_t queue;
+    assert(ready_queue_init(&queue, 4, compare_key_then_index, key) == 0);
+    assert(queue.size == 0);
+    assert(ready_queue_pop(&queue) == -1 && ready_queue_peek(&queue) == -1);
+
+    ready_queue_push(&queue, 0);
+    assert(ready_queue_peek(&queue) == 0 && queue.size == 1);
+    assert(ready_queue_pop(&queue) == 0);
+    assert(ready_queue_pop(&queue) == -1 && ready_queue_peek(&queue) == -1 && queue.size == 0);
+
+    ready_queue_free(&queue);
+    printf("--- test_ready_queue_empty PASSED ---\n");
+}
+
+/**
+ * @brief Claves con muchos empates: el comparador los desempata por índice y el
+ * orden de salida no depende del orden de inserción.
+ */
+void test_ready_queue_ties() {
+    printf("--- Ejecutando test_ready_queue_ties ---\n");
+
+    int key[NUM_ELEMENTS];
+    int order[NUM_ELEMENTS];
+    unsigned int seed = 11;
+    for (int i = 0; i < NUM_ELEMENTS; i++) {
+        seed = seed * 1103515245u + 12345u;
+        key[i] = (int)((seed >> 16) % 5); // Solo 5 claves distintas
+        order[i] = i;
+    }
+    // Inserción en orden aleatorio (Fisher-Yates)
+    for (int i = NUM_ELEMENTS - 1; i > 0; i--) {
+        seed = seed * 1103515245u + 12345u;
+        int j = (int)((seed >> 16) % (unsigned)(i + 1));
+        int tmp = order[i];
+        order[i] = order[j];
+        order[j] = tmp;
+    }
+
+    ready_queue_t queue;
+    assert(ready_queue_init(&queue, NUM_ELEMENTS, compare_key_then_index, key) == 0);
+    for (int i = 0; i < NUM_ELEMENTS; i++) ready_queue_push(&queue, order[i]);
+
+    int previous = ready_queue_pop(&queue);
+    for (int i = 1; i < NUM_ELEMENTS; i++) {
+        int idx = ready_queue_pop(&queue);
+        assert(compare_key_then_index(key, previous, idx) < 0);
+        previous = idx;
+    }
+    assert(ready_queue_pop(&queue) == -1);
+
+    ready_queue_free(&queue);
+    printf("--- test_ready_queue_ties PASSED ---\n");
+}
+
+/**
+ * @brief Capacidad inicial 0 y 1: la cola crece al insertar y, con inserciones
+ * y extracciones intercaladas, siempre entrega el mínimo de una referencia lineal.
+ */
+void test_ready_queue_growth() {
+    printf("--- Ejecutando test_ready_queue_growth ---\n");
+
+    int key[NUM_ELEMENTS];
+    char queued[NUM_ELEMENTS];
+    unsigned int seed = 23;
+    for (int i = 0; i < NUM_ELEMENTS; i++) {
+        seed = seed * 1103515245u + 12345u;
+        key[i] = (int)((seed >> 16) % 100);
+    }
+
+    for (int capacity = 0; capacity <= 1; capacity++) {
+        ready_queue_t queue;
+        assert(ready_queue_init(&queue, capacity, compare_key_then_index, key) == 0);
+        memset(queued, 0, sizeof(queued));
+        int next = 0, popped = 0;
+
+        while (popped < NUM_ELEMENTS) {
+            // Tres inserciones por cada extracción hasta agotar los elementos
+            for (int k = 0; k < 3 && next < NUM_ELEMENTS; k++) {
+                ready_queue_push(&queue, next);
+                queued[next++] = 1;
+            }
+            assert(queue.capacity >= queue.size);
+
+            int expected = -1;
+            for (int i = 0; i < next; i++) {
+                if (queued[i] && (expected == -1 || compare_key_then_index(key, i, expected) < 0)) expected = i;
+            }
+            assert(ready_queue_peek(&queue) == expected);
+            assert(ready_queue_pop(&queue) == expected);
+            queued[expected] = 0;
+            popped++;
+        }
+        assert(queue.size == 0 && queue.capacity >= NUM_ELEMENTS / 2);
+        ready_queue_free(&queue);
+    }
+
+    printf("--- test_ready_queue_growth PASSED ---\n");
+}
+
+int main() {
+    test_ready_queue_empty();
+    test_ready_queue_ties();
+    test_ready_queue_growth();
+    return 0;
+}
@@ -13,9 +13,9 @@
 // PID 3: Arrival=2, Burst=8
 process_t test_processes[] = {
     // PID | Arrival | Burst | Priority | Rem | Start | Comp | TAT | WT | RT
-    {1, 0, 5, 1, 0, -1, 0, 0, 0, 0, 0, 0}, 
-    {2, 1, 3, 2, 0, -1, 0, 0, 0, 0, 0, 0}, 
-    {3, 2, 8, 1, 0, -1, 0, 0, 0, 0, 0, 0}  
+    {1, 0, 5, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0}, 
+    {2, 1, 3, 2, 0, -1, 0, 0, 0, 0, 0, 0, 0}, 
+    {3, 2, 8, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0}  
 };
 const int NUM_TEST_PROCESSES = 3;
 const int TEST_QUANTUM = 3;
@@ -30,15 +30,16 @@ void test_schedule_rr() {
     printf("--- Ejecutando test_schedule_rr (Quantum=%d) ---\n", TEST_QUANTUM);
 
     // 1. Inicialización de datos
-    process_t processes[MAX_PROCESSES];
-    timeline_event_t timeline[MAX_TIMELINE_EVENTS];
+    process_t processes[NUM_TEST_PROCESSES];
+    timeline_t timeline;
     metrics_t metrics;
+    timeline_init(&timeline);
     
     // Usamos reset_processes para cargar la copia limpia del workload
     reset_processes(processes, NUM_TEST_PROCESSES, test_processes);
     
     // 2. Ejecutar el algoritmo Round Robin
-    schedule_rr(processes, NUM_TEST_PROCESSES, TEST_QUANTUM, timeline);
+    schedule_rr(processes, NUM_TEST_PROCESSES, TEST_QUANTUM, &timeline);
     
     // 3. Verificación de Tiempos Finales (Valores Esperados para RR q=3)
     
@@ -87,10 +88,43 @@ void test_schedule_rr() {
     assert(fabs(metrics.cpu_utilization - 100.0) < 0.01);
 
     printf("  ✅ Verificación de Métricas Promedio OK.\n");
+    timeline_free(&timeline);
     printf("--- test_schedule_rr PASSED ---\n");
 }
 
+/**
+ * @brief Un proceso solo en la cola ejecuta todos sus quantums en un despacho:
+ * el costo no depende del burst y su segmento en el Gantt no se fragmenta.
+ */
+void test_rr_quantum_skip() {
+    printf("--- Ejecutando test_rr_quantum_skip ---\n");
+
+    // q=4. P1 llega en 0 con un burst enorme; P2 llega en T=10, a mitad del quantum [8,12)
+    process_t original[] = {
+        {1, 0, 1000000000, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+        {2, 10, 2, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0}
+    };
+    process_t processes[2];
+    timeline_t timeline;
+    timeline_init(&timeline);
+    reset_processes(processes, 2, original);
+
+    schedule_rr(processes, 2, 4, &timeline);
+
+    // P1 corre [0,12) en un solo segmento; P2 llegó en T=10 y entra antes que P1 en T=12
+    assert(timeline.events[0].pid == 1 && timeline.events[0].time == 0 && timeline.events[0].duration == 12);
+    assert(timeline.events[1].pid == 2 && timeline.events[1].time == 12 && timeline.events[1].duration == 2);
+    assert(timeline.events[2].pid == 1 && timeline.events[2].time == 14);
+    assert(processes[1].start_time == 12 && processes[1].completion_time == 14);
+    assert(processes[0].completion_time == 1000000002);
+    assert(timeline.count == 4); // 3 segmentos + marcador de fin
+
+    timeline_free(&timeline);
+    printf("--- test_rr_quantum_skip PASSED ---\n");
+}
+
 int main() {
     test_schedule_rr();
+    test_rr_quantum_skip();
     return 0;
 }
@@ -0,0 +1,206 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "../include/scheduler.h"
+#include "../include/algorithms.h"
+#include "../include/ready_queue.h"
+
+#define NUM_SHARE_PROCESSES 3
+#define NUM_TREE_PROCESSES 100
+
+extern void reset_processes(process_t *processes, int n, process_t *original);
+
+// Tres procesos que compiten desde T=0 con tickets 1024 (nice 0), 526 (nice 3)
+// y 110 (nice 10): bursts largos para que ninguno termine en la ventana medida.
+process_t share_processes[] = {
+    // PID | Arrival | Burst | Priority | Rem | Start | Comp | TAT | WT | RT
+    {1, 0, 2000, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+    {2, 0, 2000, 3, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+    {3, 0, 2000, 10, 0, -1, 0, 0, 0, 0, 0, 0, 0}
+};
+static const double share_tickets[NUM_SHARE_PROCESSES] = {1024, 526, 110};
+
+/**
+ * @brief Tiempo de CPU recibido por cada proceso en [0, window).
+ */
+static void service_in_window(const timeline_t *timeline, int window, int *service) {
+    for (int i = 0; i < NUM_SHARE_PROCESSES; i++) service[i] = 0;
+    for (int e = 0; e < timeline->count && timeline->events[e].pid != 0; e++) {
+        const timeline_event_t *ev = &timeline->events[e];
+        if (ev->pid < 1 || ev->time >= window) continue;
+        int end = ev->time + ev->duration < window ? ev->time + ev->duration : window;
+        service[ev->pid - 1] += end - ev->time;
+    }
+}
+
+/**
+ * @brief Stride es determinista: en cualquier ventana cada proceso recibe su parte
+ * proporcional con un error de a lo sumo un par de quantums.
+ */
+void test_stride_proportional() {
+    printf("--- Ejecutando test_stride_proportional ---\n");
+
+    process_t processes[NUM_SHARE_PROCESSES];
+    timeline_t timeline;
+    int service[NUM_SHARE_PROCESSES];
+    timeline_init(&timeline);
+
+    reset_processes(processes, NUM_SHARE_PROCESSES, share_processes);
+    schedule_stride(processes, NUM_SHARE_PROCESSES, 1, &timeline);
+
+    for (int window = 100; window <= 3000; window += 100) {
+        service_in_window(&timeline, window, service);
+        for (int i = 0; i < NUM_SHARE_PROCESSES; i++) {
+            double ideal = window * share_tickets[i] / (1024 + 526 + 110);
+            assert(service[i] >= ideal - 2 && service[i] <= ideal + 2);
+        }
+    }
+    // El de más tickets termina primero; el de menos, al final
+    assert(processes[0].completion_time < processes[1].completion_time);
+    assert(processes[2].completion_time == 6000);
+
+    timeline_free(&timeline);
+    printf("--- test_stride_proportional PASSED ---\n");
+}
+
+/**
+ * @brief La lotería es reproducible con la misma semilla y converge al reparto
+ * proporcional (en promedio) en ventanas largas.
+ */
+void test_lottery_proportional() {
+    printf("--- Ejecutando test_lottery_proportional ---\n");
+
+    process_t processes[NUM_SHARE_PROCESSES];
+    process_t again[NUM_SHARE_PROCESSES];
+    timeline_t timeline, timeline_again;
+    int service[NUM_SHARE_PROCESSES];
+    timeline_init(&timeline);
+    timeline_init(&timeline_again);
+
+    reset_processes(processes, NUM_SHARE_PROCESSES, share_processes);
+    schedule_lottery(processes, NUM_SHARE_PROCESSES, 1, 7, &timeline);
+    reset_processes(again, NUM_SHARE_PROCESSES, share_processes);
+    schedule_lottery(again, NUM_SHARE_PROCESSES, 1, 7, &timeline_again);
+
+    assert(timeline.count == timeline_again.count);
+    for (int e = 0; e < timeline.count; e++) {
+        assert(timeline.events[e].pid == timeline_again.events[e].pid);
+        assert(timeline.events[e].duration == timeline_again.events[e].duration);
+    }
+
+    int window = 3000;
+    service_in_window(&timeline, window, service);
+    for (int i = 0; i < NUM_SHARE_PROCESSES; i++) {
+        double ideal = window * share_tickets[i] / (1024 + 526 + 110);
+        assert(service[i] >= ideal * 0.9 - 20 && service[i] <= ideal * 1.1 + 20);
+        assert(processes[i].completion_time == again[i].completion_time);
+    }
+    printf("  ✅ Ventana de %d: %d / %d / %d (ideal %.0f / %.0f / %.0f)\n", window,
+           service[0], service[1], service[2],
+           window * 1024.0 / 1660, window * 526.0 / 1660, window * 110.0 / 1660);
+
+    timeline_free(&timeline);
+    timeline_free(&timeline_again);
+    printf("--- test_lottery_proportional PASSED ---\n");
+}
+
+/**
+ * @brief Con llegadas escalonadas y huecos: ambos planificadores ejecutan cada
+ * proceso exactamente su burst, después de su llegada y sin solapamientos.
+ */
+void test_share_conserves_work() {
+    printf("--- Ejecutando test_share_conserves_work ---\n");
+
+    process_t original[NUM_TREE_PROCESSES];
+    process_t processes[NUM_TREE_PROCESSES];
+    timeline_t timeline;
+    unsigned int seed = 31;
+    timeline_init(&timeline);
+
+    for (int round = 0; round < 100; round++) {
+        int n = 1 + round % NUM_TREE_PROCESSES;
+        for (int i = 0; i < n; i++) {
+            memset(&original[i], 0, sizeof(process_t));
+            original[i].pid = i + 1;
+            seed = seed * 1103515245u + 12345u;
+            original[i].arrival_time = (seed >> 16) % 200;
+            seed = seed * 1103515245u + 12345u;
+            original[i].burst_time = 1 + (seed >> 16) % 12;
+            original[i].priority = (int)((seed >> 8) % 40) - 20;
+        }
+
+        for (int alg = 0; alg < 2; alg++) {
+            int quantum = 1 + round % 4;
+            int executed[NUM_TREE_PROCESSES] = {0};
+            reset_processes(processes, n, original);
+            if (alg == 0) {
+                schedule_stride(processes, n, quantum, &timeline);
+            } else {
+                schedule_lottery(processes, n, quantum, round, &timeline);
+            }
+
+            int clock = 0;
+            for (int e = 0; e < timeline.count && timeline.events[e].pid != 0; e++) {
+                const timeline_event_t *ev = &timeline.events[e];
+                assert(ev->time == clock);
+                clock += ev->duration;
+                if (ev->pid > 0) {
+                    executed[ev->pid - 1] += ev->duration;
+                    assert(ev->time >= processes[ev->pid - 1].arrival_time);
+                }
+            }
+            for (int i = 0; i < n; i++) {
+                assert(executed[i] == processes[i].burst_time);
+                assert(processes[i].start_time >= processes[i].arrival_time);
+            }
+        }
+    }
+
+    timeline_free(&timeline);
+    printf("  ✅ Trabajo conservado en stride y lotería.\n");
+    printf("--- test_share_conserves_work PASSED ---\n");
+}
+
+/**
+ * @brief ticket_tree_find devuelve el dueño de cada ticket, comparado con una
+ * búsqueda lineal sobre los tickets acumulados.
+ */
+void test_ticket_tree_find() {
+    printf("--- Ejecutando test_ticket_tree_find ---\n");
+
+    long long tickets[NUM_TREE_PROCESSES] = {0};
+    ticket_tree_t tree;
+    unsigned int seed = 5;
+    assert(ticket_tree_init(&tree, NUM_TREE_PROCESSES) == 0);
+
+    for (int step = 0; step < 2000; step++) {
+        seed = seed * 1103515245u + 12345u;
+        int idx = (seed >> 16) % NUM_TREE_PROCESSES;
+        long long delta = tickets[idx] > 0 && (seed & 1) ? -tickets[idx] : (long long)((seed >> 4) % 1000);
+        tickets[idx] += delta;
+        ticket_tree_add(&tree, idx, delta);
+        if (tree.total == 0) continue;
+
+        seed = seed * 1103515245u + 12345u;
+        long long ticket = (seed >> 8) % tree.total;
+        long long acc = 0;
+        int expected = -1;
+        for (int i = 0; i < NUM_TREE_PROCESSES && expected == -1; i++) {
+            acc += tickets[i];
+            if (acc > ticket) expected = i;
+        }
+        assert(ticket_tree_find(&tree, ticket) == expected);
+    }
+
+    ticket_tree_free(&tree);
+    printf("--- test_ticket_tree_find PASSED ---\n");
+}
+
+int main() {
+    test_stride_proportional();
+    test_lottery_proportional();
+    test_share_conserves_work();
+    test_ticket_tree_find();
+    return 0;
+}
@@ -10,9 +10,9 @@
 // --- Workload de Prueba (Workload 1) ---
 process_t test_processes[] = {
     // PID | Arrival | Burst | Priority | Rem | Start | Comp | TAT | WT | RT
-    {1, 0, 5, 1, 0, -1, 0, 0, 0, 0, 0, 0}, 
-    {2, 1, 3, 2, 0, -1, 0, 0, 0, 0, 0, 0}, 
-    {3, 2, 8, 1, 0, -1, 0, 0, 0, 0, 0, 0}  
+    {1, 0, 5, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0}, 
+    {2, 1, 3, 2, 0, -1, 0, 0, 0, 0, 0, 0, 0}, 
+    {3, 2, 8, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0}  
 };
 const int NUM_TEST_PROCESSES = 3;
 
@@ -26,15 +26,16 @@ void test_schedule_sjf() {
     printf("--- Ejecutando test_schedule_sjf ---\n");
 
     // 1. Inicialización de datos
-    process_t processes[MAX_PROCESSES];
-    timeline_event_t timeline[MAX_TIMELINE_EVENTS];
+    process_t processes[NUM_TEST_PROCESSES];
+    timeline_t timeline;
     metrics_t metrics;
+    timeline_init(&timeline);
     
     // Usamos reset_processes para cargar la copia limpia del workload
     reset_processes(processes, NUM_TEST_PROCESSES, test_processes);
     
     // 2. Ejecutar el algoritmo SJF
-    schedule_sjf(processes, NUM_TEST_PROCESSES, timeline);
+    schedule_sjf(processes, NUM_TEST_PROCESSES, &timeline);
     
     // 3. Cálculos y Verificación de Tiempos Finales (Valores Esperados para SJF)
     
@@ -88,6 +89,7 @@ void test_schedule_sjf() {
     assert(fabs(metrics.cpu_utilization - 100.0) < 0.01);
 
     printf("  ✅ Verificación de Métricas Promedio OK.\n");
+    timeline_free(&timeline);
     printf("--- test_schedule_sjf PASSED ---\n");
 }
 
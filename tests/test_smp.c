@@ -0,0 +1,202 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h> // Para fabs
+#include "../include/scheduler.h"
+#include "../include/algorithms.h"
+#include "../include/metrics.h"
+#include "../include/smp.h"
+
+// --- Workload de Prueba (Workload 1) ---
+// PID 1: Arrival=0, Burst=5
+// PID 2: Arrival=1, Burst=3
+// PID 3: Arrival=2, Burst=8
+process_t test_processes[] = {
+    // PID | Arrival | Burst | Priority | Rem | Start | Comp | TAT | WT | RT
+    {1, 0, 5, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+    {2, 1, 3, 2, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+    {3, 2, 8, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0}
+};
+const int NUM_TEST_PROCESSES = 3;
+
+#define NUM_RANDOM_PROCESSES 40
+#define NUM_TEST_CPUS 4
+
+extern void reset_processes(process_t *processes, int n, process_t *original);
+
+/**
+ * @brief Genera un workload pseudoaleatorio reproducible (LCG).
+ */
+static void generate_workload(process_t *processes, int n, unsigned int *seed) {
+    for (int i = 0; i < n; i++) {
+        memset(&processes[i], 0, sizeof(process_t));
+        processes[i].pid = i + 1;
+        *seed = *seed * 1103515245u + 12345u;
+        processes[i].arrival_time = (*seed >> 16) % 60;
+        *seed = *seed * 1103515245u + 12345u;
+        processes[i].burst_time = 1 + (*seed >> 16) % 15;
+        processes[i].start_time = -1;
+    }
+}
+
+/**
+ * @brief Con 2 CPUs y FIFO: P1 en CPU0, P2 en CPU1; P3 espera en CPU0 y la CPU1
+ * lo roba al quedar libre en T=4.
+ */
+void test_smp_two_cpus_fifo() {
+    printf("--- Ejecutando test_smp_two_cpus_fifo ---\n");
+
+    process_t processes[NUM_TEST_PROCESSES];
+    timeline_t timelines[2];
+    metrics_t metrics;
+    double cpu_utilization[2];
+    smp_config_t config = {.num_cpus = 2, .policy = SMP_FIFO};
+    timeline_init(&timelines[0]);
+    timeline_init(&timelines[1]);
+
+    reset_processes(processes, NUM_TEST_PROCESSES, test_processes);
+    assert(schedule_smp(processes, NUM_TEST_PROCESSES, &config, timelines) == 0);
+
+    // CPU0: P1 [0-5]. CPU1: IDLE [0-1], P2 [1-4], P3 [4-12]
+    assert(processes[0].start_time == 0 && processes[0].completion_time == 5);
+    assert(processes[1].start_time == 1 && processes[1].completion_time == 4);
+    assert(processes[2].start_time == 4 && processes[2].completion_time == 12);
+    assert(timelines[1].events[0].pid == -1 && timelines[1].events[0].duration == 1);
+    assert(timelines[1].events[2].pid == 3 && timelines[1].events[2].time == 4);
+
+    calculate_smp_metrics(processes, NUM_TEST_PROCESSES, 12, timelines, 2, &metrics, cpu_utilization);
+    assert(fabs(cpu_utilization[0] - 41.67) < 0.01);    // 5 / 12
+    assert(fabs(cpu_utilization[1] - 91.67) < 0.01);    // 11 / 12
+    assert(fabs(metrics.cpu_utilization - 66.67) < 0.01); // 16 / 24
+    assert(fabs(metrics.throughput - 0.25) < 0.01);     // 3 procesos / 12
+
+    timeline_free(&timelines[0]);
+    timeline_free(&timelines[1]);
+    printf("--- test_smp_two_cpus_fifo PASSED ---\n");
+}
+
+/**
+ * @brief Con una sola CPU, cada política debe dar los mismos resultados que su
+ * algoritmo de un solo CPU.
+ */
+void test_smp_single_cpu_matches() {
+    printf("--- Ejecutando test_smp_single_cpu_matches ---\n");
+
+    process_t original[NUM_RANDOM_PROCESSES];
+    process_t expected[NUM_RANDOM_PROCESSES];
+    process_t actual[NUM_RANDOM_PROCESSES];
+    timeline_t timeline;
+    unsigned int seed = 2024;
+    timeline_init(&timeline);
+
+    for (int round = 0; round < 200; round++) {
+        int n = 1 + round % NUM_RANDOM_PROCESSES;
+        generate_workload(original, n, &seed);
+
+        smp_config_t config = {.num_cpus = 1, .quantum = 1 + round % 5, .balance_interval = round % 7};
+        config.mlfq.num_queues = 1 + round % 4;
+        for (int level = 0; level < config.mlfq.num_queues; level++) {
+            config.mlfq.quantums[level] = 1 + (round + 2 * level) % 6;
+        }
+        config.mlfq.boost_interval = round % 3 == 0 ? 0 : 5 + round % 20;
+
+        for (int p = SMP_FIFO; p <= SMP_MLFQ; p++) {
+            config.policy = (smp_policy_t)p;
+            reset_processes(expected, n, original);
+            switch (config.policy) {
+                case SMP_FIFO: schedule_fifo(expected, n, &timeline); break;
+                case SMP_STCF: schedule_stcf(expected, n, &timeline); break;
+                case SMP_RR: schedule_rr(expected, n, config.quantum, &timeline); break;
+                case SMP_MLFQ: schedule_mlfq(expected, n, &config.mlfq, &timeline); break;
+            }
+            reset_processes(actual, n, original);
+            assert(schedule_smp(actual, n, &config, &timeline) == 0);
+
+            for (int i = 0; i < n; i++) {
+                assert(actual[i].start_time == expected[i].start_time);
+                assert(actual[i].completion_time == expected[i].completion_time);
+            }
+        }
+    }
+
+    timeline_free(&timeline);
+    printf("  ✅ 1 CPU idéntico a FIFO, STCF, RR y MLFQ.\n");
+    printf("--- test_smp_single_cpu_matches PASSED ---\n");
+}
+
+/**
+ * @brief Con varias CPUs: cada proceso recibe exactamente su burst, nunca se
+ * ejecuta en dos CPUs a la vez y ninguna CPU tiene segmentos solapados.
+ */
+void test_smp_conserves_work() {
+    printf("--- Ejecutando test_smp_conserves_work (%d CPUs) ---\n", NUM_TEST_CPUS);
+
+    process_t original[NUM_RANDOM_PROCESSES];
+    process_t processes[NUM_RANDOM_PROCESSES];
+    timeline_t timelines[NUM_TEST_CPUS];
+    unsigned int seed = 99;
+    for (int c = 0; c < NUM_TEST_CPUS; c++) timeline_init(&timelines[c]);
+
+    for (int round = 0; round < 100; round++) {
+        generate_workload(original, NUM_RANDOM_PROCESSES, &seed);
+        smp_config_t config = {.num_cpus = 1 + round % NUM_TEST_CPUS, .quantum = 2, .balance_interval = round % 4};
+        config.mlfq.num_queues = 3;
+        config.mlfq.quantums[0] = 2;
+        config.mlfq.quantums[1] = 4;
+        config.mlfq.quantums[2] = 8;
+        config.mlfq.boost_interval = 10;
+
+        for (int p = SMP_FIFO; p <= SMP_MLFQ; p++) {
+            config.policy = (smp_policy_t)p;
+            reset_processes(processes, NUM_RANDOM_PROCESSES, original);
+            assert(schedule_smp(processes, NUM_RANDOM_PROCESSES, &config, timelines) == 0);
+
+            int executed[NUM_RANDOM_PROCESSES] = {0};
+
+            for (int c = 0; c < config.num_cpus; c++) {
+                int cpu_time = 0;
+                for (int e = 0; e < timelines[c].count && timelines[c].events[e].pid != 0; e++) {
+                    const timeline_event_t *ev = &timelines[c].events[e];
+                    assert(ev->time >= cpu_time);
+                    cpu_time = ev->time + ev->duration;
+                    if (ev->pid > 0) {
+                        executed[ev->pid - 1] += ev->duration;
+                        assert(ev->time >= processes[ev->pid - 1].arrival_time);
+                        assert(cpu_time <= processes[ev->pid - 1].completion_time);
+                    }
+                }
+            }
+            for (int i = 0; i < NUM_RANDOM_PROCESSES; i++) {
+                assert(executed[i] == processes[i].burst_time);
+            }
+
+            // Sin solapamiento del mismo proceso entre CPUs: recorrer en orden de tiempo
+            for (int t = 0, progress = 1; progress; t++) {
+                progress = 0;
+                int running_at_t[NUM_RANDOM_PROCESSES] = {0};
+                for (int c = 0; c < config.num_cpus; c++) {
+                    for (int e = 0; e < timelines[c].count && timelines[c].events[e].pid != 0; e++) {
+                        const timeline_event_t *ev = &timelines[c].events[e];
+                        if (ev->time + ev->duration > t) progress = 1;
+                        if (ev->pid > 0 && ev->time <= t && t < ev->time + ev->duration) {
+                            assert(!running_at_t[ev->pid - 1]);
+                            running_at_t[ev->pid - 1] = 1;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    for (int c = 0; c < NUM_TEST_CPUS; c++) timeline_free(&timelines[c]);
+    printf("  ✅ Trabajo conservado y sin ejecuciones simultáneas.\n");
+    printf("--- test_smp_conserves_work PASSED ---\n");
+}
+
+int main() {
+    test_smp_two_cpus_fifo();
+    test_smp_single_cpu_matches();
+    test_smp_conserves_work();
+    return 0;
+}
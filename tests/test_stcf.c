@@ -6,6 +6,7 @@
 #include "../include/scheduler.h"
 #include "../include/algorithms.h"
 #include "../include/metrics.h"
+#include "../include/argmin.h"
 
 // --- Workload de Prueba (Workload 2: Prueba de Preempción) ---
 // T=0: Solo P1 llega (Burst=8). P1 ejecuta 1s.
@@ -16,9 +17,9 @@
 
 process_t test_processes[] = {
     // PID | Arrival | Burst | Priority | Rem | Start | Comp | TAT | WT | RT
-    {1, 0, 8, 1, 0, -1, 0, 0, 0, 0, 0, 0}, 
-    {2, 1, 4, 1, 0, -1, 0, 0, 0, 0, 0, 0}, 
-    {3, 5, 9, 1, 0, -1, 0, 0, 0, 0, 0, 0}  
+    {1, 0, 8, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0}, 
+    {2, 1, 4, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0}, 
+    {3, 5, 9, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0}  
 };
 const int NUM_TEST_PROCESSES = 3;
 const int EXPECTED_TOTAL_TIME = 21; // 8 + 4 + 9 = 21
@@ -33,15 +34,16 @@ void test_schedule_stcf() {
     printf("--- Ejecutando test_schedule_stcf (Preemptive) ---\n");
 
     // 1. Inicialización de datos
-    process_t processes[MAX_PROCESSES];
-    timeline_event_t timeline[MAX_TIMELINE_EVENTS];
+    process_t processes[NUM_TEST_PROCESSES];
+    timeline_t timeline;
     metrics_t metrics;
+    timeline_init(&timeline);
     
     // Usamos reset_processes para cargar la copia limpia del workload
     reset_processes(processes, NUM_TEST_PROCESSES, test_processes);
     
     // 2. Ejecutar el algoritmo STCF
-    schedule_stcf(processes, NUM_TEST_PROCESSES, timeline);
+    schedule_stcf(processes, NUM_TEST_PROCESSES, &timeline);
     
     // 3. Verificación de Tiempos Finales (Valores Esperados)
     
@@ -56,7 +58,7 @@ void test_schedule_stcf() {
     assert(processes[1].completion_time == 5);
     
     // P3 (PID 3, Burst 9, Arrivo 5): Ejecuta [12-21]
-    // Start=12, Completion=21. TAT=16. WT = 9+2=11. RT=7. (12-5=7)
+    // Start=12, Completion=21. TAT=16. WT = 16-9=7. RT=7. (12-5=7)
     // Nota: Aunque P3 llegó en T=5, tuvo que esperar hasta T=12.
     assert(processes[2].start_time == 12);
     assert(processes[2].completion_time == 21);
@@ -72,8 +74,8 @@ void test_schedule_stcf() {
     // TATs: P1=12, P2=4, P3=16. Total TAT = 32. Avg TAT = 32 / 3 ≈ 10.666...
     assert(fabs(metrics.avg_turnaround_time - 10.67) < 0.01);
 
-    // WTs: P1=4, P2=0, P3=12. Total WT = 16. Avg WT = 16 / 3 ≈ 5.333...
-    assert(fabs(metrics.avg_waiting_time - 5.33) < 0.01);
+    // WTs: P1=4, P2=0, P3=16-9=7. Total WT = 11. Avg WT = 11 / 3 ≈ 3.666...
+    assert(fabs(metrics.avg_waiting_time - 3.67) < 0.01);
     
     // RTs: P1=0, P2=0, P3=7. Total RT = 7. Avg RT = 7 / 3 ≈ 2.333...
     assert(fabs(metrics.avg_response_time - 2.33) < 0.01);
@@ -82,10 +84,98 @@ void test_schedule_stcf() {
     assert(fabs(metrics.cpu_utilization - 100.0) < 0.01);
 
     printf("  ✅ Verificación de Métricas Promedio OK.\n");
+    timeline_free(&timeline);
     printf("--- test_schedule_stcf PASSED ---\n");
 }
 
+/**
+ * @brief Verifica que el motor por eventos produzca la misma salida que la versión por ticks.
+ */
+void test_stcf_event_matches_tick() {
+    printf("--- Ejecutando test_stcf_event_matches_tick ---\n");
+
+    const int n = 40;
+    process_t workload[n];
+    process_t by_tick[n];
+    process_t by_event[n];
+    timeline_t timeline_tick;
+    timeline_t timeline_event;
+    timeline_init(&timeline_tick);
+    timeline_init(&timeline_event);
+
+    // Workload pseudoaleatorio reproducible (LCG) con huecos IDLE y empates
+    unsigned int seed = 12345;
+    int arrival = 0;
+    for (int i = 0; i < n; i++) {
+        seed = seed * 1103515245u + 12345u;
+        arrival += (seed >> 16) % 6;
+        seed = seed * 1103515245u + 12345u;
+        process_t p = {i + 1, arrival, 1 + (int)((seed >> 16) % 9), 1, 0, -1, 0, 0, 0, 0, 0, 0, 0};
+        workload[i] = p;
+    }
+
+    reset_processes(by_tick, n, workload);
+    reset_processes(by_event, n, workload);
+    schedule_stcf_tick(by_tick, n, &timeline_tick);
+    schedule_stcf(by_event, n, &timeline_event);
+
+    for (int i = 0; i < n; i++) {
+        assert(by_tick[i].start_time == by_event[i].start_time);
+        assert(by_tick[i].completion_time == by_event[i].completion_time);
+    }
+    assert(timeline_tick.count == timeline_event.count);
+    for (int i = 0; i < timeline_tick.count; i++) {
+        assert(timeline_tick.events[i].time == timeline_event.events[i].time);
+        assert(timeline_tick.events[i].pid == timeline_event.events[i].pid);
+        assert(timeline_tick.events[i].duration == timeline_event.events[i].duration);
+    }
+
+    printf("  ✅ Línea de tiempo y resultados idénticos (%d eventos).\n", timeline_event.count);
+    timeline_free(&timeline_tick);
+    timeline_free(&timeline_event);
+    printf("--- test_stcf_event_matches_tick PASSED ---\n");
+}
+
+/**
+ * @brief Verifica que los kernels vectoriales de selección coincidan con el escalar,
+ * incluyendo empates de remaining/arrival y tamaños que no son múltiplo del ancho SIMD.
+ */
+void test_eligible_argmin_matches_scalar() {
+    printf("--- Ejecutando test_eligible_argmin_matches_scalar (%s) ---\n", eligible_argmin_name());
+
+    int arrival[67];
+    int remaining[67];
+    unsigned int seed = 777;
+
+    for (int round = 0; round < 2000; round++) {
+        int n = round % 68;
+        for (int i = 0; i < n; i++) {
+            seed = seed * 1103515245u + 12345u;
+            arrival[i] = (seed >> 16) % 20;
+            seed = seed * 1103515245u + 12345u;
+            remaining[i] = (seed >> 16) % 5; // Muchos ceros (terminados) y empates
+        }
+        int now = round % 25;
+        int expected = eligible_argmin_scalar(arrival, remaining, n, now);
+
+        assert(eligible_argmin(arrival, remaining, n, now) == expected);
+#if defined(__x86_64__) || defined(__i386__)
+        if (__builtin_cpu_supports("sse4.1")) {
+            assert(eligible_argmin_sse41(arrival, remaining, n, now) == expected);
+        }
+        if (__builtin_cpu_supports("avx2")) {
+            assert(eligible_argmin_avx2(arrival, remaining, n, now) == expected);
+        }
+#endif
+    }
+
+    printf("  ✅ Kernels vectoriales idénticos al escalar.\n");
+    printf("--- test_eligible_argmin_matches_scalar PASSED ---\n");
+}
+
 int main() {
     test_schedule_stcf();
+    test_stcf_event_matches_tick();
+    test_eligible_argmin_matches_scalar();
     return 0;
 }
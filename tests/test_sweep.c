@@ -0,0 +1,107 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "../include/scheduler.h"
+#include "../include/sweep.h"
+
+// --- Workload de Prueba (Workload 1) ---
+process_t test_processes[] = {
+    // PID | Arrival | Burst | Priority | Rem | Start | Comp | TAT | WT | RT
+    {1, 0, 5, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+    {2, 1, 3, 2, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+    {3, 2, 8, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0}
+};
+const int NUM_TEST_PROCESSES = 3;
+
+/**
+ * @brief Verifica el parseo de rangos y la expansión de la rejilla.
+ */
+void test_sweep_expand() {
+    printf("--- Ejecutando test_sweep_expand ---\n");
+
+    sweep_range_t range;
+    assert(sweep_parse_range("1:10:3", &range) == 0);
+    assert(range.min == 1 && range.max == 10 && range.step == 3);
+    assert(sweep_parse_range("4", &range) == 0);
+    assert(range.min == 4 && range.max == 4 && range.step == 1);
+    assert(sweep_parse_range("1:x", &range) == -1);
+    assert(sweep_parse_range("1:2:0", &range) == -1);
+    assert(sweep_parse_range("1:2:3:4", &range) == -1);
+
+    // RR: q = 1, 3, 5 | MLFQ: 2..3 colas x base 2 x factor 1..2 x boost 10, 20
+    sweep_grid_t grid = {
+        .rr_quantum = {1, 5, 2},
+        .mlfq_queues = {2, 3, 1},
+        .mlfq_quantum = {2, 2, 1},
+        .mlfq_factor = {1, 2, 1},
+        .mlfq_boost = {10, 20, 10}
+    };
+    sweep_config_t *configs;
+    int count = sweep_expand(&grid, &configs);
+    assert(count == 3 + 2 * 1 * 2 * 2);
+
+    assert(configs[0].kind == SWEEP_RR && configs[0].quantum == 1);
+    assert(configs[2].kind == SWEEP_RR && configs[2].quantum == 5);
+
+    // Última configuración: 3 colas, quantums 2, 4, 8, boost 20
+    const sweep_config_t *last = &configs[count - 1];
+    assert(last->kind == SWEEP_MLFQ);
+    assert(last->mlfq.num_queues == 3);
+    assert(last->mlfq.quantums[0] == 2 && last->mlfq.quantums[1] == 4 && last->mlfq.quantums[2] == 8);
+    assert(last->mlfq.boost_interval == 20);
+    free(configs);
+
+    printf("  ✅ Rejilla expandida correctamente (%d configuraciones).\n", count);
+    printf("--- test_sweep_expand PASSED ---\n");
+}
+
+/**
+ * @brief El pool con robo de trabajo debe producir exactamente los mismos
+ * resultados que una ejecución secuencial, cada uno en su posición.
+ */
+void test_sweep_parallel_matches_sequential() {
+    printf("--- Ejecutando test_sweep_parallel_matches_sequential ---\n");
+
+    sweep_grid_t grid = {
+        .rr_quantum = {1, 12, 1},
+        .mlfq_queues = {1, MAX_QUEUES, 1},
+        .mlfq_quantum = {1, 3, 1},
+        .mlfq_factor = {1, 2, 1},
+        .mlfq_boost = {0, 10, 5}
+    };
+    sweep_config_t *configs;
+    int count = sweep_expand(&grid, &configs);
+    assert(count > 0);
+
+    sweep_result_t *sequential = calloc(count, sizeof(sweep_result_t));
+    sweep_result_t *parallel = calloc(count, sizeof(sweep_result_t));
+    assert(sequential && parallel);
+
+    assert(run_sweep(test_processes, NUM_TEST_PROCESSES, configs, count, sequential, 1) == 0);
+    assert(run_sweep(test_processes, NUM_TEST_PROCESSES, configs, count, parallel, 8) == 0);
+
+    for (int i = 0; i < count; i++) {
+        assert(memcmp(&parallel[i].config, &configs[i], sizeof(sweep_config_t)) == 0);
+        assert(memcmp(&parallel[i], &sequential[i], sizeof(sweep_result_t)) == 0);
+    }
+
+    // La tabla ordenada empieza por la mejor configuración
+    sort_sweep_results(parallel, count);
+    for (int i = 1; i < count; i++) {
+        assert(parallel[i - 1].metrics.avg_turnaround_time <= parallel[i].metrics.avg_turnaround_time);
+    }
+
+    free(sequential);
+    free(parallel);
+    free(configs);
+
+    printf("  ✅ %d configuraciones idénticas en paralelo y en secuencial.\n", count);
+    printf("--- test_sweep_parallel_matches_sequential PASSED ---\n");
+}
+
+int main() {
+    test_sweep_expand();
+    test_sweep_parallel_matches_sequential();
+    return 0;
+}
@@ -0,0 +1,182 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "../include/scheduler.h"
+#include "../include/algorithms.h"
+#include "../include/buffers.h"
+#include "../include/compact_timeline.h"
+
+#define NUM_RANDOM_PROCESSES 50
+#define NUM_TRACE_PROCESSES 1000
+#define TRACE_BURST 1000
+
+extern void reset_processes(process_t *processes, int n, process_t *original);
+
+/**
+ * @brief Versión de referencia: fusiona en un nuevo timeline_t los segmentos
+ * contiguos del mismo pid.
+ */
+static void merge_reference(const timeline_t *source, timeline_t *merged) {
+    timeline_clear(merged);
+    for (int i = 0; i < source->count; i++) {
+        const timeline_event_t *ev = &source->events[i];
+        timeline_event_t *last = merged->count > 0 ? &merged->events[merged->count - 1] : NULL;
+        if (last && last->pid == ev->pid && last->time + last->duration == ev->time) {
+            last->duration += ev->duration;
+        } else {
+            timeline_append(merged, ev->time, ev->pid, ev->duration);
+        }
+    }
+}
+
+/**
+ * @brief El iterador devuelve exactamente los segmentos de la referencia.
+ */
+static void assert_matches_reference(const compact_timeline_t *compact, const timeline_t *merged) {
+    compact_timeline_iter_t iter;
+    timeline_event_t ev;
+    int i = 0;
+    compact_timeline_iter_init(&iter, compact);
+    while (compact_timeline_next(&iter, &ev)) {
+        assert(i < merged->count);
+        assert(ev.time == merged->events[i].time);
+        assert(ev.pid == merged->events[i].pid);
+        assert(ev.duration == merged->events[i].duration);
+        i++;
+    }
+    assert(i == merged->count && compact->count == merged->count);
+}
+
+/**
+ * @brief Ida y vuelta sobre las líneas de tiempo de varios planificadores
+ * (con segmentos IDLE y despachos consecutivos del mismo proceso).
+ */
+void test_compact_roundtrip_schedulers() {
+    printf("--- Ejecutando test_compact_roundtrip_schedulers ---\n");
+
+    process_t original[NUM_RANDOM_PROCESSES];
+    process_t processes[NUM_RANDOM_PROCESSES];
+    timeline_t timeline, merged;
+    compact_timeline_t compact;
+    mlfq_config_t mlfq = {.num_queues = 3, .quantums = {1, 2, 4}, .boost_interval = 20};
+    unsigned int seed = 99;
+    timeline_init(&timeline);
+    timeline_init(&merged);
+    compact_timeline_init(&compact);
+
+    for (int round = 0; round < 100; round++) {
+        int n = 1 + round % NUM_RANDOM_PROCESSES;
+        for (int i = 0; i < n; i++) {
+            memset(&original[i], 0, sizeof(process_t));
+            original[i].pid = i + 1;
+            seed = seed * 1103515245u + 12345u;
+            original[i].arrival_time = (seed >> 16) % 100;
+            seed = seed * 1103515245u + 12345u;
+            original[i].burst_time = 1 + (seed >> 16) % 12;
+        }
+
+        for (int alg = 0; alg < 4; alg++) {
+            reset_processes(processes, n, original);
+            switch (alg) {
+                case 0: schedule_fifo(processes, n, &timeline); break;
+                case 1: schedule_stcf(processes, n, &timeline); break;
+                case 2: schedule_rr(processes, n, 1, &timeline); break;
+                default: schedule_mlfq(processes, n, &mlfq, &timeline); break;
+            }
+            merge_reference(&timeline, &merged);
+            compact_timeline_build(&compact, &timeline);
+            assert_matches_reference(&compact, &merged);
+            assert(compact.end_time == merged.events[merged.count - 1].time);
+        }
+    }
+
+    compact_timeline_free(&compact);
+    timeline_free(&merged);
+    timeline_free(&timeline);
+    printf("--- test_compact_roundtrip_schedulers PASSED ---\n");
+}
+
+/**
+ * @brief Valores extremos: pids grandes y negativos, huecos, solapamientos y
+ * duraciones largas se conservan exactamente.
+ */
+void test_compact_extreme_values() {
+    printf("--- Ejecutando test_compact_extreme_values ---\n");
+
+    const timeline_event_t events[] = {
+        {0, -1, 7}, {7, 2147483647, 1}, {100, 3, 2000000000}, {50, -2147483647, 0},
+        {50, 5, 1}, {51, 5, 2}, {53, 5, 0}, {2147483600, 4, 40}, {0, 0, 0}
+    };
+    int count = (int)(sizeof(events) / sizeof(events[0]));
+    timeline_t timeline, merged;
+    compact_timeline_t compact;
+    timeline_init(&timeline);
+    timeline_init(&merged);
+    compact_timeline_init(&compact);
+
+    for (int i = 0; i < count; i++) {
+        timeline_append(&timeline, events[i].time, events[i].pid, events[i].duration);
+    }
+    merge_reference(&timeline, &merged);
+    compact_timeline_build(&compact, &timeline);
+    assert(compact.count == count - 2); // P5 [50-53] queda en un solo segmento
+    assert_matches_reference(&compact, &merged);
+
+    compact_timeline_clear(&compact);
+    timeline_event_t ev;
+    compact_timeline_iter_t iter;
+    compact_timeline_iter_init(&iter, &compact);
+    assert(compact_timeline_next(&iter, &ev) == 0);
+
+    compact_timeline_free(&compact);
+    timeline_free(&merged);
+    timeline_free(&timeline);
+    printf("--- test_compact_extreme_values PASSED ---\n");
+}
+
+/**
+ * @brief Traza de 10^6 despachos (RR, q=1, 1000 procesos): la versión compacta
+ * ocupa al menos 5 veces menos memoria que timeline_t.
+ */
+void test_compact_memory() {
+    printf("--- Ejecutando test_compact_memory ---\n");
+
+    process_t *original = calloc(NUM_TRACE_PROCESSES, sizeof(process_t));
+    process_t *processes = malloc(NUM_TRACE_PROCESSES * sizeof(process_t));
+    assert(original && processes);
+    for (int i = 0; i < NUM_TRACE_PROCESSES; i++) {
+        original[i].pid = i + 1;
+        original[i].arrival_time = i;
+        original[i].burst_time = TRACE_BURST;
+    }
+
+    timeline_t timeline;
+    compact_timeline_t compact;
+    timeline_init(&timeline);
+    compact_timeline_init(&compact);
+
+    reset_processes(processes, NUM_TRACE_PROCESSES, original);
+    schedule_rr(processes, NUM_TRACE_PROCESSES, 1, &timeline);
+    compact_timeline_build(&compact, &timeline);
+
+    size_t raw = (size_t)timeline.count * sizeof(timeline_event_t);
+    size_t packed = compact_timeline_bytes(&compact);
+    printf("  ✅ %d segmentos: %zu bytes -> %zu bytes (%.1fx)\n",
+           timeline.count, raw, packed, (double)raw / packed);
+    assert(timeline.count > 900000);
+    assert(packed * 5 <= raw);
+
+    compact_timeline_free(&compact);
+    timeline_free(&timeline);
+    free(processes);
+    free(original);
+    printf("--- test_compact_memory PASSED ---\n");
+}
+
+int main() {
+    test_compact_roundtrip_schedulers();
+    test_compact_extreme_values();
+    test_compact_memory();
+    return 0;
+}
@@ -0,0 +1,149 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <unistd.h>
+#include "../include/scheduler.h"
+#include "../include/algorithms.h"
+#include "../include/smp.h"
+#include "../include/trace_export.h"
+
+#define NUM_LARGE_PROCESSES 200
+#define LARGE_BURST 500
+
+// --- Workload de Prueba (Workload 1) ---
+process_t test_processes[] = {
+    // PID | Arrival | Burst | Priority | Rem | Start | Comp | TAT | WT | RT
+    {1, 0, 5, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+    {2, 1, 3, 2, 0, -1, 0, 0, 0, 0, 0, 0, 0},
+    {3, 2, 8, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0}
+};
+const int NUM_TEST_PROCESSES = 3;
+
+extern void reset_processes(process_t *processes, int n, process_t *original);
+
+/**
+ * @brief Lee el archivo completo en memoria (solo para las verificaciones del test).
+ */
+static char *read_file(const char *path) {
+    FILE *file = fopen(path, "r");
+    assert(file);
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char *text = malloc(size + 1);
+    assert(text && fread(text, 1, size, file) == (size_t)size);
+    text[size] = '\0';
+    fclose(file);
+    return text;
+}
+
+static int count_occurrences(const char *text, const char *needle) {
+    int count = 0;
+    for (const char *p = strstr(text, needle); p; p = strstr(p + 1, needle)) count++;
+    return count;
+}
+
+/**
+ * @brief 2 CPUs con RR (q=3): CPU0 P1 [0-3], P3 [3-11]; CPU1 P2 [1-4], P1 [4-6].
+ * La cola de listos vale 1 en [2, 4) (P3 y luego P1 esperan) y 0 en el resto.
+ */
+void test_trace_smp_rr() {
+    printf("--- Ejecutando test_trace_smp_rr ---\n");
+
+    process_t processes[NUM_TEST_PROCESSES];
+    timeline_t timelines[2];
+    smp_config_t config = {.num_cpus = 2, .policy = SMP_RR, .quantum = 3};
+    char path[] = "/tmp/test_trace_XXXXXX";
+    int fd = mkstemp(path);
+    assert(fd >= 0);
+    close(fd);
+    timeline_init(&timelines[0]);
+    timeline_init(&timelines[1]);
+
+    reset_processes(processes, NUM_TEST_PROCESSES, test_processes);
+    assert(schedule_smp(processes, NUM_TEST_PROCESSES, &config, timelines) == 0);
+    assert(trace_export_chrome(path, processes, NUM_TEST_PROCESSES, timelines, 2) == 0);
+
+    char *text = read_file(path);
+    assert(strncmp(text, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", 40) == 0);
+    assert(strcmp(text + strlen(text) - 4, "\n]}\n") == 0);
+    assert(strstr(text, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"CPU 1\"}}"));
+    assert(strstr(text, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":2,\"tid\":3,\"args\":{\"name\":\"P3\"}}"));
+
+    // Cada tramo aparece en el hilo de su CPU y en el de su proceso
+    assert(strstr(text, "{\"name\":\"P3\",\"ph\":\"X\",\"pid\":1,\"tid\":0,\"ts\":3,\"dur\":8}"));
+    assert(strstr(text, "{\"name\":\"CPU 1\",\"ph\":\"X\",\"pid\":2,\"tid\":1,\"ts\":4,\"dur\":2}"));
+    assert(count_occurrences(text, "\"ph\":\"X\"") == 8);
+
+    assert(strstr(text, "\"ts\":0,\"args\":{\"listos\":0}}"));
+    assert(strstr(text, "\"ts\":2,\"args\":{\"listos\":1}}"));
+    assert(strstr(text, "\"ts\":4,\"args\":{\"listos\":0}}"));
+    assert(count_occurrences(text, "\"ph\":\"C\"") == 3);
+
+    free(text);
+    unlink(path);
+    timeline_free(&timelines[0]);
+    timeline_free(&timelines[1]);
+    printf("--- test_trace_smp_rr PASSED ---\n");
+}
+
+/**
+ * @brief Una traza grande (RR, q=1) sale completa: un par de eventos X por
+ * despacho (el buffer se vuelca muchas veces) y el JSON queda bien cerrado.
+ */
+void test_trace_large() {
+    printf("--- Ejecutando test_trace_large ---\n");
+
+    process_t *original = calloc(NUM_LARGE_PROCESSES, sizeof(process_t));
+    process_t *processes = malloc(NUM_LARGE_PROCESSES * sizeof(process_t));
+    assert(original && processes);
+    for (int i = 0; i < NUM_LARGE_PROCESSES; i++) {
+        original[i].pid = i + 1;
+        original[i].burst_time = LARGE_BURST;
+    }
+    timeline_t timeline;
+    char path[] = "/tmp/test_trace_XXXXXX";
+    int fd = mkstemp(path);
+    assert(fd >= 0);
+    close(fd);
+    timeline_init(&timeline);
+
+    reset_processes(processes, NUM_LARGE_PROCESSES, original);
+    schedule_rr(processes, NUM_LARGE_PROCESSES, 1, &timeline);
+    assert(trace_export_chrome(path, processes, NUM_LARGE_PROCESSES, &timeline, 1) == 0);
+
+    char *text = read_file(path);
+    assert(strlen(text) > 10 * TRACE_BUFFER_SIZE);
+    assert(count_occurrences(text, "\"ph\":\"X\"") == 2 * NUM_LARGE_PROCESSES * LARGE_BURST);
+    assert(strcmp(text + strlen(text) - 4, "\n]}\n") == 0);
+    printf("  ✅ %d despachos exportados (%zu bytes).\n", NUM_LARGE_PROCESSES * LARGE_BURST, strlen(text));
+
+    free(text);
+    unlink(path);
+    timeline_free(&timeline);
+    free(processes);
+    free(original);
+    printf("--- test_trace_large PASSED ---\n");
+}
+
+/**
+ * @brief Un archivo que no se puede crear devuelve -1.
+ */
+void test_trace_io_error() {
+    printf("--- Ejecutando test_trace_io_error ---\n");
+
+    timeline_t timeline;
+    timeline_init(&timeline);
+    assert(trace_export_chrome("/nonexistent_dir/trace.json", test_processes, NUM_TEST_PROCESSES,
+                               &timeline, 1) == -1);
+    timeline_free(&timeline);
+    printf("--- test_trace_io_error PASSED ---\n");
+}
+
+int main() {
+    test_trace_smp_rr();
+    test_trace_large();
+    test_trace_io_error();
+    return 0;
+}
@@ -0,0 +1,302 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <stddef.h>
+#include <unistd.h>
+#include "../include/scheduler.h"
+#include "../include/buffers.h"
+#include "../include/workload.h"
+#include "../include/proc_table.h"
+#include "../include/algorithms.h"
+
+/**
+ * @brief Escribe contents en un archivo temporal; path debe terminar en XXXXXX.
+ */
+static void write_temp(char *path, const char *contents) {
+    int fd = mkstemp(path);
+    assert(fd >= 0);
+    size_t len = strlen(contents);
+    assert(write(fd, contents, len) == (ssize_t)len);
+    close(fd);
+}
+
+/**
+ * @brief Carga contents como workload CSV.
+ * @return El resultado de load_workload.
+ */
+static int load_csv(const char *contents, process_set_t *set) {
+    char path[] = "/tmp/test_workload_XXXXXX";
+    write_temp(path, contents);
+    int status = load_workload(path, set);
+    unlink(path);
+    return status;
+}
+
+/**
+ * @brief Comentarios, líneas vacías, CRLF, espacios y la columna Deadline opcional.
+ */
+void test_workload_csv() {
+    printf("--- Ejecutando test_workload_csv ---\n");
+
+    process_set_t set;
+    process_set_init(&set);
+    const char *contents =
+        "# PID, Arrival Time, Burst Time, Priority[, Deadline]\n"
+        "\n"
+        "1, 0, 5, 1\r\n"
+        "   \t\n"
+        "\r\n"
+        "2,1,3,2,10\n"
+        "# comentario intermedio\n"
+        "  3 ,\t2 , 8 , -1 , 0 \r\n"
+        "4, 7, 1, 0";                   // Última línea sin salto de línea
+    assert(load_csv(contents, &set) == 0);
+    assert(set.count == 4);
+
+    const int expected[4][5] = {{1, 0, 5, 1, 0}, {2, 1, 3, 2, 10}, {3, 2, 8, -1, 0}, {4, 7, 1, 0, 0}};
+    for (int i = 0; i < 4; i++) {
+        const process_t *p = &set.items[i];
+        assert(p->pid == expected[i][0] && p->arrival_time == expected[i][1]);
+        assert(p->burst_time == expected[i][2] && p->priority == expected[i][3]);
+        assert(p->deadline == expected[i][4]);
+        assert(p->remaining_time == p->burst_time && p->start_time == -1 && p->completion_time == 0);
+    }
+
+    // Archivo vacío o solo con comentarios: cero procesos
+    assert(load_csv("", &set) == 0 && set.count == 0);
+    assert(load_csv("# nada\n\n", &set) == 0 && set.count == 0);
+
+    process_set_free(&set);
+    printf("--- test_workload_csv PASSED ---\n");
+}
+
+/**
+ * @brief Filas mal formadas o con valores que no se pueden simular: error y
+ * conjunto vacío.
+ */
+void test_workload_csv_invalid() {
+    printf("--- Ejecutando test_workload_csv_invalid ---\n");
+
+    const char *invalid[] = {
+        "1, 0, 5\n",                    // Faltan columnas
+        "1, 0, 5, 1, 2, 3\n",           // Sobran columnas
+        "1, 0, x, 1\n",                 // No numérico
+        "1, 0, 5, 1 extra\n",           // Basura al final
+        "1, 0, 5,, 1\n",                // Campo vacío
+        "1, 0, 99999999999, 1\n",       // Fuera del rango de int
+        "1, -1, 5, 1\n",                // Llegada negativa
+        "1, 0, 0, 1\n",                 // Burst nulo
+        "1, 0, -5, 1\n",                // Burst negativo
+        "1, 0, 5, 1, -3\n",             // Deadline negativo
+        "1, 0, 5, 1\n2, 1, 0, 1\n",     // Error en una línea posterior
+    };
+    process_set_t set;
+    process_set_init(&set);
+    for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++) {
+        assert(load_csv(invalid[i], &set) == -1);
+        assert(set.count == 0);
+    }
+    assert(load_workload("/tmp/no_existe_workload.txt", &set) == -1);
+
+    process_set_free(&set);
+    printf("--- test_workload_csv_invalid PASSED ---\n");
+}
+
+/**
+ * @brief CSV -> binario -> load_workload conserva todos los campos; la vista
+ * mapeada expone las mismas columnas.
+ */
+void test_workload_bin_roundtrip() {
+    printf("--- Ejecutando test_workload_bin_roundtrip ---\n");
+
+    const char *contents[] = {
+        "# Sin deadlines\n1, 0, 5, 1\n2, 1, 3, 2\n3, 2, 8, -1\n",
+        "# Con deadlines\n1, 0, 5, 1, 9\n2, 1, 3, 2\n3, 2, 8, 1, 20\n"
+    };
+    process_set_t csv, bin;
+    process_set_init(&csv);
+    process_set_init(&bin);
+
+    for (int k = 0; k < 2; k++) {
+        char csv_path[] = "/tmp/test_workload_XXXXXX";
+        char bin_path[] = "/tmp/test_workload_XXXXXX";
+        write_temp(csv_path, contents[k]);
+        write_temp(bin_path, "");
+        assert(convert_workload(csv_path, bin_path) == 0);
+        assert(load_workload(csv_path, &csv) == 0);
+        assert(load_workload(bin_path, &bin) == 0);
+
+        assert(bin.count == csv.count && csv.count == 3);
+        for (int i = 0; i < csv.count; i++) {
+            assert(memcmp(&bin.items[i], &csv.items[i], sizeof(process_t)) == 0);
+        }
+
+        workload_view_t view;
+        assert(workload_bin_open(bin_path, &view) == 0);
+        assert(view.count == 3 && (view.deadline != NULL) == k);
+        for (int i = 0; i < view.count; i++) {
+            assert(view.pid[i] == csv.items[i].pid && view.arrival[i] == csv.items[i].arrival_time);
+            assert(view.burst[i] == csv.items[i].burst_time && view.priority[i] == csv.items[i].priority);
+            if (view.deadline) assert(view.deadline[i] == csv.items[i].deadline);
+        }
+        workload_bin_close(&view);
+        unlink(csv_path);
+        unlink(bin_path);
+    }
+
+    process_set_free(&csv);
+    process_set_free(&bin);
+    printf("--- test_workload_bin_roundtrip PASSED ---\n");
+}
+
+/**
+ * @brief Archivos binarios inválidos: truncados, con firma o versión incorrecta,
+ * o con valores que no se pueden simular.
+ */
+void test_workload_bin_invalid() {
+    printf("--- Ejecutando test_workload_bin_invalid ---\n");
+
+    process_t processes[3] = {
+        {1, 0, 5, 1, 5, -1, 0, 0, 0, 0, 0, 0, 0},
+        {2, 1, 3, 2, 3, -1, 0, 0, 0, 0, 0, 0, 0},
+        {3, 2, 8, 1, 8, -1, 0, 0, 0, 0, 0, 0, 0}
+    };
+    char path[] = "/tmp/test_workload_XXXXXX";
+    write_temp(path, "");
+    assert(workload_bin_write(path, processes, 3) == 0);
+
+    FILE *file = fopen(path, "rb");
+    assert(file);
+    unsigned char valid[256];
+    size_t size = fread(valid, 1, sizeof(valid), file);
+    fclose(file);
+    assert(size == sizeof(workload_bin_header_t) + 4 * 3 * sizeof(int32_t));
+
+    workload_view_t view;
+    process_set_t set;
+    process_set_init(&set);
+
+    // 1. Truncado: dentro del encabezado y dentro de las columnas
+    const size_t truncated[] = {4, sizeof(workload_bin_header_t) - 1, size - 1};
+    for (int k = 0; k < 3; k++) {
+        file = fopen(path, "wb");
+        assert(file && fwrite(valid, 1, truncated[k], file) == truncated[k]);
+        fclose(file);
+        assert(workload_bin_open(path, &view) == -1);
+        if (truncated[k] >= 8) assert(load_workload(path, &set) == -1 && set.count == 0);
+    }
+
+    // 2. Firma incorrecta (ya no se detecta como binario: falla como CSV) y versión incorrecta
+    unsigned char corrupt[256];
+    memcpy(corrupt, valid, size);
+    corrupt[0] ^= 0xFF;
+    file = fopen(path, "wb");
+    assert(file && fwrite(corrupt, 1, size, file) == size);
+    fclose(file);
+    assert(workload_bin_open(path, &view) == -1);
+    assert(load_workload(path, &set) == -1 && set.count == 0);
+
+    memcpy(corrupt, valid, size);
+    corrupt[offsetof(workload_bin_header_t, version)] = WORKLOAD_BIN_VERSION + 1;
+    file = fopen(path, "wb");
+    assert(file && fwrite(corrupt, 1, size, file) == size);
+    fclose(file);
+    assert(workload_bin_open(path, &view) == -1);
+    assert(load_workload(path, &set) == -1 && set.count == 0);
+
+    // 3. Bien formado pero con un burst nulo
+    processes[2].burst_time = 0;
+    assert(workload_bin_write(path, processes, 3) == 0);
+    assert(workload_bin_open(path, &view) == 0);
+    assert(workload_bin_validate(&view, path) == -1);
+    workload_bin_close(&view);
+    assert(load_workload(path, &set) == -1 && set.count == 0);
+
+    unlink(path);
+    process_set_free(&set);
+    printf("--- test_workload_bin_invalid PASSED ---\n");
+}
+
+/**
+ * @brief proc_table_load_view usa las columnas mapeadas sin copiarlas y los
+ * planificadores dan sobre ella los mismos resultados que sobre process_t.
+ */
+void test_workload_bin_table() {
+    printf("--- Ejecutando test_workload_bin_table ---\n");
+
+    const char *contents[] = {
+        "# Sin deadlines\n1, 0, 5, 1\n2, 1, 3, 2\n3, 2, 8, -1\n4, 20, 2, 0\n",
+        "# Con deadlines\n1, 0, 5, 1, 9\n2, 1, 3, 2\n3, 2, 8, 1, 20\n4, 20, 2, 0, 1\n"
+    };
+    process_set_t set;
+    timeline_t expected, actual;
+    process_set_init(&set);
+    timeline_init(&expected);
+    timeline_init(&actual);
+
+    for (int k = 0; k < 2; k++) {
+        char csv_path[] = "/tmp/test_workload_XXXXXX";
+        char bin_path[] = "/tmp/test_workload_XXXXXX";
+        write_temp(csv_path, contents[k]);
+        write_temp(bin_path, "");
+        assert(convert_workload(csv_path, bin_path) == 0);
+        assert(load_workload(csv_path, &set) == 0);
+
+        workload_view_t view;
+        proc_table_t table;
+        assert(workload_is_bin(bin_path) && !workload_is_bin(csv_path));
+        assert(workload_bin_open(bin_path, &view) == 0);
+        assert(workload_bin_validate(&view, bin_path) == 0);
+        assert(proc_table_load_view(&table, &view) == 0);
+
+        // Las columnas de entrada son las del archivo mapeado
+        assert(table.n == view.count);
+        assert(table.arrival == (const int *)view.arrival && table.burst == (const int *)view.burst);
+        assert(table.pid == (const int *)view.pid && table.priority == (const int *)view.priority);
+        assert(k ? table.deadline == (const int *)view.deadline : table.deadline[3] == 0);
+
+        // Dos pasadas (con proc_table_reset en medio) sobre la misma tabla
+        for (int alg = 0; alg < 2; alg++) {
+            for (int i = 0; i < set.count; i++) {
+                set.items[i].remaining_time = set.items[i].burst_time;
+                set.items[i].start_time = -1;
+                set.items[i].completion_time = 0;
+            }
+            proc_table_reset(&table);
+            if (alg == 0) {
+                schedule_fifo(set.items, set.count, &expected);
+                schedule_fifo_table(&table, &actual);
+            } else {
+                schedule_stcf(set.items, set.count, &expected);
+                schedule_stcf_table(&table, &actual);
+            }
+            assert(actual.count == expected.count);
+            assert(memcmp(actual.events, expected.events, expected.count * sizeof(timeline_event_t)) == 0);
+            for (int i = 0; i < set.count; i++) {
+                assert(table.start[i] == set.items[i].start_time);
+                assert(table.completion[i] == set.items[i].completion_time);
+                assert(table.remaining[i] == set.items[i].remaining_time);
+            }
+        }
+
+        proc_table_free(&table);
+        workload_bin_close(&view);
+        unlink(csv_path);
+        unlink(bin_path);
+    }
+
+    timeline_free(&expected);
+    timeline_free(&actual);
+    process_set_free(&set);
+    printf("--- test_workload_bin_table PASSED ---\n");
+}
+
+int main() {
+    test_workload_csv();
+    test_workload_csv_invalid();
+    test_workload_bin_roundtrip();
+    test_workload_bin_invalid();
+    test_workload_bin_table();
+    return 0;
+}
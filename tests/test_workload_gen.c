@@ -0,0 +1,272 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <assert.h>
+#include "../include/scheduler.h"
+#include "../include/algorithms.h"
+#include "../include/metrics.h"
+#include "../include/workload_gen.h"
+#include "../include/stream_sim.h"
+
+#define NUM_SAMPLES 200000
+#define NUM_STREAM_PROCESSES 2000
+#define NUM_LARGE_PROCESSES 1000000
+
+/**
+ * @brief Misma semilla, mismos procesos; llegadas no decrecientes y pids consecutivos.
+ */
+void test_workload_gen_reproducible() {
+    printf("--- Ejecutando test_workload_gen_reproducible ---\n");
+
+    workload_gen_config_t config;
+    workload_gen_t a, b, c;
+    process_t pa, pb, pc;
+    workload_gen_default_config(&config);
+    config.count = 10000;
+    config.arrivals = ARRIVAL_MMPP;
+    config.bursts = BURST_PARETO;
+    assert(workload_gen_init(&a, &config) == 0);
+    assert(workload_gen_init(&b, &config) == 0);
+    config.seed++;
+    assert(workload_gen_init(&c, &config) == 0);
+
+    int differences = 0, last_arrival = 0;
+    long long produced = 0;
+    while (workload_gen_next(&a, &pa)) {
+        assert(workload_gen_next(&b, &pb) && workload_gen_next(&c, &pc));
+        assert(memcmp(&pa, &pb, sizeof(process_t)) == 0);
+        differences += pa.burst_time != pc.burst_time;
+        assert(pa.pid == ++produced && pa.arrival_time >= last_arrival);
+        assert(pa.burst_time >= 1 && pa.priority >= 1 && pa.priority <= config.num_priorities);
+        assert(pa.remaining_time == pa.burst_time && pa.start_time == -1 && pa.deadline == 0);
+        last_arrival = pa.arrival_time;
+    }
+    assert(produced == config.count && !workload_gen_next(&b, &pb));
+    assert(differences > config.count / 2);
+
+    // Parámetros fuera de rango
+    workload_gen_default_config(&config);
+    config.utilization = 0;
+    assert(workload_gen_init(&a, &config) != 0);
+    workload_gen_default_config(&config);
+    config.bursts = BURST_PARETO;
+    config.pareto_alpha = 1.0;
+    assert(workload_gen_init(&a, &config) != 0);
+    workload_gen_default_config(&config);
+    config.num_priorities = WORKLOAD_GEN_MAX_PRIORITIES + 1;
+    assert(workload_gen_init(&a, &config) != 0);
+
+    // Las llegadas no pasan de WORKLOAD_GEN_MAX_ARRIVAL
+    workload_gen_default_config(&config);
+    config.utilization = 1e-6; // Una llegada cada ~10^7 unidades
+    assert(workload_gen_init(&a, &config) == 0);
+    produced = 0;
+    while (workload_gen_next(&a, &pa)) {
+        assert(pa.arrival_time <= WORKLOAD_GEN_MAX_ARRIVAL);
+        produced++;
+    }
+    assert(produced > 0 && produced < config.count);
+
+    printf("--- test_workload_gen_reproducible PASSED ---\n");
+}
+
+/**
+ * @brief Las ráfagas tienen la media pedida y la carga ofrecida se acerca a la
+ * utilización objetivo; Pareto tiene la cola más pesada; las prioridades siguen Zipf.
+ */
+void test_workload_gen_distributions() {
+    printf("--- Ejecutando test_workload_gen_distributions ---\n");
+
+    const burst_model_t models[] = {BURST_EXPONENTIAL, BURST_PARETO, BURST_BIMODAL};
+    const char *names[] = {"exponencial", "pareto", "bimodal"};
+    int max_burst[3];
+
+    for (int m = 0; m < 3; m++) {
+        workload_gen_config_t config;
+        workload_gen_t gen;
+        process_t p;
+        workload_gen_default_config(&config);
+        config.count = NUM_SAMPLES;
+        config.bursts = models[m];
+        config.pareto_alpha = 2.5; // Varianza finita: la media muestral converge
+        config.num_priorities = 5;
+        config.priority_skew = 1.0;
+        assert(workload_gen_init(&gen, &config) == 0);
+
+        double sum_burst = 0;
+        int last_arrival = 0, long_jobs = 0, priority_count[5] = {0};
+        max_burst[m] = 0;
+        while (workload_gen_next(&gen, &p)) {
+            sum_burst += p.burst_time;
+            last_arrival = p.arrival_time;
+            long_jobs += p.burst_time > 3 * config.mean_burst;
+            priority_count[p.priority - 1]++;
+            if (p.burst_time > max_burst[m]) max_burst[m] = p.burst_time;
+        }
+
+        double mean = sum_burst / NUM_SAMPLES;
+        double load = sum_burst / last_arrival;
+        printf("  ✅ %s: media %.2f, carga %.3f, máximo %d\n", names[m], mean, load, max_burst[m]);
+        assert(fabs(mean - config.mean_burst) < 0.03 * config.mean_burst);
+        assert(fabs(load - config.utilization) < 0.03);
+        if (models[m] == BURST_BIMODAL) {
+            // Geométrica de media mu: P(X > t) = (1 - 1/mu)^t, en cada modo
+            double f = config.bimodal_long_fraction, t = 3 * config.mean_burst;
+            double expected = (1 - f) * pow(1 - 1 / gen.short_mean, t) +
+                              f * pow(1 - 1 / (gen.short_mean * config.bimodal_ratio), t);
+            assert(fabs((double)long_jobs / NUM_SAMPLES - expected) < 0.1 * expected);
+        }
+
+        // Zipf s = 1: P(k) = (1/k) / H_5
+        double harmonic = 1 + 1 / 2.0 + 1 / 3.0 + 1 / 4.0 + 1 / 5.0;
+        for (int k = 0; k < 5; k++) {
+            double expected = 1.0 / (k + 1) / harmonic;
+            assert(fabs((double)priority_count[k] / NUM_SAMPLES - expected) < 0.01);
+        }
+    }
+    assert(max_burst[1] > 2 * max_burst[0]);
+
+    printf("--- test_workload_gen_distributions PASSED ---\n");
+}
+
+/**
+ * @brief Con la misma tasa media, MMPP concentra las llegadas: la varianza del
+ * número de llegadas por ventana supera con creces a la de Poisson (= media).
+ */
+void test_workload_gen_mmpp() {
+    printf("--- Ejecutando test_workload_gen_mmpp ---\n");
+
+    double dispersion[2], rate[2];
+    for (int model = 0; model < 2; model++) {
+        workload_gen_config_t config;
+        workload_gen_t gen;
+        process_t p;
+        workload_gen_default_config(&config);
+        config.count = NUM_SAMPLES;
+        config.arrivals = model ? ARRIVAL_MMPP : ARRIVAL_POISSON;
+        assert(workload_gen_init(&gen, &config) == 0);
+
+        const int window = 500;
+        double sum = 0, sum_squared = 0;
+        int windows = 0, in_window = 0, window_end = window, last_arrival = 0;
+        while (workload_gen_next(&gen, &p)) {
+            while (p.arrival_time >= window_end) {
+                sum += in_window;
+                sum_squared += (double)in_window * in_window;
+                windows++;
+                in_window = 0;
+                window_end += window;
+            }
+            in_window++;
+            last_arrival = p.arrival_time;
+        }
+        double mean = sum / windows;
+        dispersion[model] = (sum_squared / windows - mean * mean) / mean;
+        rate[model] = (double)NUM_SAMPLES / last_arrival;
+    }
+
+    printf("  ✅ Índice de dispersión: Poisson %.2f, MMPP %.2f\n", dispersion[0], dispersion[1]);
+    assert(dispersion[0] > 0.8 && dispersion[0] < 1.2);
+    assert(dispersion[1] > 5 * dispersion[0]);
+    assert(fabs(rate[1] - rate[0]) < 0.1 * rate[0]);
+    printf("--- test_workload_gen_mmpp PASSED ---\n");
+}
+
+/**
+ * @brief La simulación en streaming da exactamente las métricas y los despachos
+ * de los planificadores de algorithms.c sobre el mismo workload materializado.
+ */
+void test_stream_matches_materialized() {
+    printf("--- Ejecutando test_stream_matches_materialized ---\n");
+
+    const stream_policy_t policies[] = {STREAM_FIFO, STREAM_SJF, STREAM_STCF, STREAM_RR};
+    process_set_t set;
+    timeline_t timeline;
+    metrics_acc_t expected, actual;
+    process_set_init(&set);
+    timeline_init(&timeline);
+    timeline.stats = &expected;
+
+    for (int round = 0; round < 12; round++) {
+        workload_gen_config_t config;
+        workload_gen_t gen;
+        workload_gen_default_config(&config);
+        config.count = NUM_STREAM_PROCESSES;
+        config.seed = round;
+        config.arrivals = round % 2 ? ARRIVAL_MMPP : ARRIVAL_POISSON;
+        config.bursts = (burst_model_t)(round % 3);
+        config.utilization = round < 6 ? 0.7 : 1.1; // También con sobrecarga (la cola crece)
+        assert(workload_gen_init(&gen, &config) == 0);
+        set.count = 0;
+        assert(workload_gen_fill(&gen, &set) == NUM_STREAM_PROCESSES);
+
+        for (int p = 0; p < 4; p++) {
+            int quantum = 1 + round % 4;
+            switch (policies[p]) {
+                case STREAM_FIFO: schedule_fifo(set.items, set.count, &timeline); break;
+                case STREAM_SJF: schedule_sjf(set.items, set.count, &timeline); break;
+                case STREAM_STCF: schedule_stcf(set.items, set.count, &timeline); break;
+                default: schedule_rr(set.items, set.count, quantum, &timeline); break;
+            }
+            long long dispatches = 0;
+            for (int e = 0; e < timeline.count; e++) dispatches += timeline.events[e].pid > 0;
+            for (int i = 0; i < set.count; i++) {
+                set.items[i].remaining_time = set.items[i].burst_time;
+                set.items[i].start_time = -1;
+            }
+
+            stream_result_t result;
+            assert(workload_gen_init(&gen, &config) == 0);
+            assert(simulate_stream(&gen, policies[p], quantum, &actual, &result) == 0);
+
+            assert(result.processes == NUM_STREAM_PROCESSES && actual.completed == expected.completed);
+            assert(result.end_time == expected.max_completion && actual.max_completion == expected.max_completion);
+            assert(actual.sum_tat == expected.sum_tat && actual.sum_wt == expected.sum_wt);
+            assert(actual.sum_rt == expected.sum_rt && actual.sum_tat_squared == expected.sum_tat_squared);
+            assert(result.dispatches == dispatches);
+            assert(result.peak_in_system >= 1 && result.peak_in_system <= NUM_STREAM_PROCESSES);
+        }
+    }
+
+    timeline_free(&timeline);
+    process_set_free(&set);
+    printf("--- test_stream_matches_materialized PASSED ---\n");
+}
+
+/**
+ * @brief 10^6 procesos al 90% de carga: la memoria depende de los procesos en el
+ * sistema a la vez, no del total simulado.
+ */
+void test_stream_bounded_memory() {
+    printf("--- Ejecutando test_stream_bounded_memory ---\n");
+
+    workload_gen_config_t config;
+    workload_gen_t gen;
+    metrics_acc_t acc;
+    metrics_t metrics;
+    stream_result_t result;
+    workload_gen_default_config(&config);
+    config.count = NUM_LARGE_PROCESSES;
+    config.arrivals = ARRIVAL_MMPP;
+    assert(workload_gen_init(&gen, &config) == 0);
+    assert(simulate_stream(&gen, STREAM_RR, 4, &acc, &result) == 0);
+    metrics_acc_finish(&acc, &metrics);
+
+    printf("  ✅ %lld procesos, %lld despachos, máximo %d en el sistema, Avg TAT %.1f, CPU %.1f%%\n",
+           result.processes, result.dispatches, result.peak_in_system,
+           metrics.avg_turnaround_time, metrics.cpu_utilization);
+    assert(result.processes == NUM_LARGE_PROCESSES);
+    assert(result.peak_in_system < NUM_LARGE_PROCESSES / 100);
+    assert(fabs(metrics.cpu_utilization - 90.0) < 3.0);
+    printf("--- test_stream_bounded_memory PASSED ---\n");
+}
+
+int main() {
+    test_workload_gen_reproducible();
+    test_workload_gen_distributions();
+    test_workload_gen_mmpp();
+    test_stream_matches_materialized();
+    test_stream_bounded_memory();
+    return 0;
+}